@@ -31,16 +31,69 @@ let anchorLine = null;     // dashed line from anchor to vessel
 let trackLegend = null;    // Leaflet control for day-colour legend
 let recentTrackCount = C.DEFAULT_RECENT_TRACK_COUNT; // Number of most-recent tracks to colour (rest shown pale white)
 let trackByDay = new Map();    // Cached track data keyed by YYYY-MM-DD (local)
+let trackLodByDay = new Map(); // Simplified LOD levels per day (coarse/medium/fine)
 let tracksIndex = [];          // Metadata from tracks_index.json (all sailing days ever)
 let olderTrackLayer = null;    // Leaflet layer for older tracks shown in white
+let trackRenderer = null;      // Shared L.canvas renderer for all track layers
 let lat, lon; // Global variables for coordinates
 let vesselState = ''; // 'underway' | 'at anchor' | ''
 let vesselData = null; // Global vessel information
 
 // ---------------------------------------------------------------------------
-// localStorage forecast cache  —  TTL-based, silently degrades if unavailable
+// Async payload cache — IndexedDB, TTL-based, silently degrades if unavailable.
+// Entries are stored structured-clone (no JSON.stringify on the main thread)
+// and IndexedDB's quota is far beyond localStorage's 5 MB, so large forecast
+// payloads cache reliably. localStorage remains as the fallback for browsers
+// that block IndexedDB (some private windows); keys are unchanged either way.
 // ---------------------------------------------------------------------------
-function getCached(key, ttlMs) {
+const CACHE_DB_NAME = 'mermug-cache';
+const CACHE_DB_STORE = 'payloads';
+let cacheDbPromise = null;
+
+function openCacheDb() {
+  if (cacheDbPromise) return cacheDbPromise;
+  cacheDbPromise = new Promise((resolve) => {
+    if (typeof indexedDB === 'undefined') { resolve(null); return; }
+    try {
+      const req = indexedDB.open(CACHE_DB_NAME, 1);
+      req.onupgradeneeded = () => req.result.createObjectStore(CACHE_DB_STORE);
+      req.onsuccess = () => resolve(req.result);
+      req.onerror = () => resolve(null);
+      req.onblocked = () => resolve(null);
+    } catch { resolve(null); }
+  });
+  return cacheDbPromise;
+}
+
+function idbRequest(mode, run) {
+  return openCacheDb().then((db) => {
+    if (!db) return undefined;
+    return new Promise((resolve, reject) => {
+      const req = run(db.transaction(CACHE_DB_STORE, mode).objectStore(CACHE_DB_STORE));
+      req.onsuccess = () => resolve(req.result);
+      req.onerror = () => reject(req.error);
+    });
+  });
+}
+
+async function getCached(key, ttlMs) {
+  const data = await readCachedEntry(key, ttlMs);
+  perfCount(data === null ? 'cacheMisses' : 'cacheHits');
+  return data;
+}
+
+async function readCachedEntry(key, ttlMs) {
+  try {
+    const entry = await idbRequest('readonly', (store) => store.get(key));
+    if (entry !== undefined) {
+      if (!entry) return null;
+      if (Date.now() - entry.ts > ttlMs) {
+        idbRequest('readwrite', (store) => store.delete(key)).catch(() => {});
+        return null;
+      }
+      return entry.data;
+    }
+  } catch { /* IndexedDB broke mid-flight — try localStorage below */ }
   try {
     const raw = localStorage.getItem(key);
     if (!raw) return null;
@@ -49,9 +102,102 @@ function getCached(key, ttlMs) {
     return data;
   } catch { return null; }
 }
-function setCached(key, data) {
+
+async function setCached(key, data) {
+  try {
+    const result = await idbRequest('readwrite', (store) =>
+      store.put({ ts: Date.now(), data }, key));
+    if (result !== undefined) return;
+  } catch { /* fall through */ }
   try { localStorage.setItem(key, JSON.stringify({ ts: Date.now(), data })); } catch { /* quota */ }
 }
+
+// Conditional fetch: remember each URL's ETag / Last-Modified and revalidate
+// with them on refetch. GitHub Pages answers an unchanged resource with a
+// bare 304, so a no-change poll becomes a header-only round trip and callers
+// can skip all downstream parsing and DOM work via `notModified`.
+const fetchValidators = new Map();
+async function conditionalFetch(url, options = {}) {
+  const validators = fetchValidators.get(url);
+  const headers = { ...(options.headers || {}) };
+  if (validators?.etag) headers['If-None-Match'] = validators.etag;
+  if (validators?.lastModified) headers['If-Modified-Since'] = validators.lastModified;
+  const fetchStart = performance.now();
+  const response = await fetch(url, { ...options, headers, cache: 'no-cache' });
+  perfRecord(`fetch ${url.split('/').pop()}`, performance.now() - fetchStart);
+  if (response.status === 304) return { notModified: true, response };
+  if (response.ok) {
+    const etag = response.headers.get('ETag');
+    const lastModified = response.headers.get('Last-Modified');
+    if (etag || lastModified) fetchValidators.set(url, { etag, lastModified });
+  }
+  return { notModified: false, response };
+}
+
+// ---------------------------------------------------------------------------
+// Perf debug overlay — add ?debug to the URL to enable. Collects fetch
+// timings, cache hit/miss counts and per-grid patch durations and renders
+// them into a fixed corner overlay, so slow panels are measurable on the
+// actual phone-over-cellular setup the site is usually viewed from. When
+// disabled, perfRecord/perfCount return immediately and nothing renders.
+// ---------------------------------------------------------------------------
+const perfDebugEnabled = typeof location !== 'undefined'
+  && new URLSearchParams(location.search).has('debug');
+const PERF_OVERLAY_MAX_ENTRIES = 24;
+const perfEntries = [];
+const perfCounters = { cacheHits: 0, cacheMisses: 0 };
+let perfBackendSummary = '';
+
+function perfRecord(label, ms) {
+  if (!perfDebugEnabled) return;
+  perfEntries.push({ label, ms });
+  if (perfEntries.length > PERF_OVERLAY_MAX_ENTRIES) perfEntries.shift();
+  renderPerfOverlay();
+}
+
+function perfCount(counter) {
+  if (!perfDebugEnabled) return;
+  perfCounters[counter] += 1;
+  renderPerfOverlay();
+}
+
+function renderPerfOverlay() {
+  if (!document.body) return; // too early — next record will render
+  let overlay = document.getElementById('perf-overlay');
+  if (!overlay) {
+    overlay = document.createElement('div');
+    overlay.id = 'perf-overlay';
+    overlay.style.cssText =
+      'position:fixed;bottom:8px;left:8px;z-index:10000;max-width:340px;' +
+      'padding:6px 8px;font:11px/1.4 monospace;color:#9f9;' +
+      'background:rgba(0,0,0,0.8);border-radius:4px;pointer-events:none;white-space:pre;';
+    document.body.appendChild(overlay);
+  }
+  const lines = [
+    `cache hits ${perfCounters.cacheHits} / misses ${perfCounters.cacheMisses}`,
+  ];
+  if (perfBackendSummary) lines.push(perfBackendSummary);
+  for (const entry of perfEntries) {
+    lines.push(`${entry.ms.toFixed(1).padStart(7)}ms  ${entry.label}`);
+  }
+  overlay.textContent = lines.join('\n');
+}
+
+// Show the Pi's own stage timings (committed by run_update) alongside the
+// browser-side numbers, so "site is slow" splits into boat vs. browser.
+async function loadBackendTimings() {
+  if (!perfDebugEnabled) return;
+  try {
+    const res = await fetch(`${C.UPDATE_METRICS_URL}?ts=${Date.now()}`);
+    if (!res.ok) return;
+    const metrics = await res.json();
+    const last = metrics.cycles?.[metrics.cycles.length - 1];
+    if (!last) return;
+    perfBackendSummary =
+      `pi: fetch ${last.fetch_ms}ms cache ${last.cache_ms}ms git ${last.git_ms}ms`;
+    renderPerfOverlay();
+  } catch { /* overlay is best-effort */ }
+}
 let tideStations = null; // Global tide stations data
 const DEFAULT_TIDE_LOCATION = {
   lat:   C.DEFAULT_TIDE_LAT,
@@ -218,6 +364,7 @@ function primeSkeletons() {
 function renderEmptyState(containerId, title, subtitle = '') {
   const container = document.getElementById(containerId);
   if (!container) return;
+  gridLastItems.delete(containerId);
   container.innerHTML = `
     <div class="empty-state">
       <strong>${title}</strong>
@@ -225,6 +372,59 @@ function renderEmptyState(containerId, title, subtitle = '') {
     </div>`;
 }
 
+// ── Incremental grid rendering ───────────────────────────────────────────────
+// Reassigning a grid's innerHTML every refresh tick re-parses kilobytes of
+// HTML and forces a full style/layout pass, which visibly flickers on slow
+// devices. renderGrid() parses the template into a detached fragment, swaps
+// only the info-items whose markup actually changed since the last tick, and
+// batches all grid writes into a single requestAnimationFrame.
+const gridLastItems = new Map();     // grid id → outerHTML per child, last render
+const gridPendingWrites = new Map(); // grid id → template html queued this tick
+let gridFlushPromise = null;
+
+function applyGridHtml(grid, html) {
+  const template = document.createElement('template');
+  template.innerHTML = html;
+  const next = Array.from(template.content.children);
+  const prev = gridLastItems.get(grid.id);
+  // First render, structural change, or a skeleton/empty state in place:
+  // swap the whole grid. Otherwise patch only the children that changed.
+  const patchable = prev && prev.length === next.length
+    && grid.children.length === next.length
+    && !grid.querySelector(':scope > .skeleton-card, :scope > .empty-state');
+  if (!patchable) {
+    grid.replaceChildren(...next);
+  } else {
+    for (let i = 0; i < next.length; i++) {
+      if (prev[i] !== next[i].outerHTML) grid.replaceChild(next[i], grid.children[i]);
+    }
+  }
+  gridLastItems.set(grid.id, next.map((el) => el.outerHTML));
+}
+
+function renderGrid(id, html) {
+  gridPendingWrites.set(id, html);
+  if (gridFlushPromise) return gridFlushPromise;
+  const raf = typeof requestAnimationFrame === 'function'
+    ? requestAnimationFrame
+    : (fn) => setTimeout(fn, 16);
+  gridFlushPromise = new Promise((resolve) => {
+    raf(() => {
+      gridFlushPromise = null;
+      for (const [gridId, pending] of gridPendingWrites) {
+        const grid = document.getElementById(gridId);
+        if (!grid) continue;
+        const patchStart = performance.now();
+        applyGridHtml(grid, pending);
+        perfRecord(`render ${gridId}`, performance.now() - patchStart);
+      }
+      gridPendingWrites.clear();
+      resolve();
+    });
+  });
+  return gridFlushPromise;
+}
+
 async function updateMapLocation(lat, lon) {
   try {
     // If inside a privacy zone, snap the geocoding lookup to the zone center
@@ -232,6 +432,24 @@ async function updateMapLocation(lat, lon) {
     const zone = getPrivacyZoneCenter(lat, lon);
     const lookupLat = zone ? zone.lat : lat;
     const lookupLon = zone ? zone.lon : lon;
+
+    // The Pi resolves and commits the name (data/telemetry/location.json) so
+    // viewers normally never hit Nominatim. Only fall back to a live lookup
+    // when the committed name is missing or clearly for somewhere else.
+    try {
+      const resp = await fetch(C.LOCATION_URL);
+      if (resp.ok) {
+        const committed = await resp.json();
+        if (committed?.name
+            && Number.isFinite(committed.latitude) && Number.isFinite(committed.longitude)
+            && haversineMeters(lookupLat, lookupLon, committed.latitude, committed.longitude)
+              <= C.LOCATION_MAX_DISTANCE_M) {
+          setStatusSentence(committed.name);
+          return;
+        }
+      }
+    } catch { /* not committed yet — use the live lookup below */ }
+
     const response = await fetch(`https://nominatim.openstreetmap.org/reverse?lat=${lookupLat}&lon=${lookupLon}&format=json&zoom=10&addressdetails=1`);
     const data = await response.json();
 
@@ -324,15 +542,37 @@ function haversineMeters(lat1, lon1, lat2, lon2) {
  *   - Legacy format: flat keys (latitude, longitude, speedOverGround, …)
  *   - New SignalK format: values array [{path, value}, …]
  */
+// SignalK paths extracted per track point. Defaults match the shared path
+// manifest (data/signalk_paths.json) that also drives the backend snapshot
+// writer; loadPathManifest() overrides them so both sides stay in sync.
+let pointPaths = {
+  position: 'navigation.position',
+  speed: 'navigation.speedOverGround',
+  course: 'navigation.courseOverGroundTrue',
+};
+
+async function loadPathManifest() {
+  try {
+    const resp = await fetch(C.SIGNALK_PATHS_URL);
+    if (!resp.ok) return;
+    const manifest = await resp.json();
+    if (manifest && manifest.point_paths && typeof manifest.point_paths === 'object') {
+      pointPaths = { ...pointPaths, ...manifest.point_paths };
+    }
+  } catch (e) {
+    // Manifest missing or unreachable — the defaults above still match it.
+  }
+}
+
 function parsePositionPoint(point) {
   if (!point || typeof point !== 'object') return null;
 
   if (Array.isArray(point.values)) {
     // New SignalK-style format
     const find = (path) => point.values.find((v) => v.path === path)?.value;
-    const pos = find('navigation.position');
-    const sog = find('navigation.speedOverGround');
-    const cog = find('navigation.courseOverGroundTrue');
+    const pos = find(pointPaths.position);
+    const sog = find(pointPaths.speed);
+    const cog = find(pointPaths.course);
     return {
       latitude: Number(pos?.latitude),
       longitude: Number(pos?.longitude),
@@ -370,9 +610,44 @@ function _gpxLinkForDay(localDay) {
   return null;
 }
 
+// Pick the simplified-track level for a zoom; above MEDIUM_MAX_ZOOM the
+// "fine" level is drawn until the full-resolution track has been fetched.
+function trackLodLevelForZoom(zoom) {
+  if (zoom <= C.TRACK_LOD_COARSE_MAX_ZOOM) return 'coarse';
+  if (zoom <= C.TRACK_LOD_MEDIUM_MAX_ZOOM) return 'medium';
+  return 'fine';
+}
+
+// Points to draw for a day at the current zoom: the matching LOD level when
+// one is loaded, otherwise whatever full/fine data trackByDay holds.
+function trackPointsForDay(day) {
+  const lod = trackLodByDay.get(day);
+  if (lod && map) {
+    const level = lod[trackLodLevelForZoom(map.getZoom())];
+    if (level && level.length) return level;
+  }
+  return trackByDay.get(day) ?? [];
+}
+
+// Thin a day's points to at most `budget` markers with an even stride,
+// always keeping the newest point so the track visibly ends at the vessel.
+function thinTrackPoints(pts, budget) {
+  if (pts.length <= budget) return pts;
+  const stride = Math.ceil(pts.length / budget);
+  const out = [];
+  for (let i = 0; i < pts.length; i += stride) out.push(pts[i]);
+  if (out[out.length - 1] !== pts[pts.length - 1]) out.push(pts[pts.length - 1]);
+  return out;
+}
+
 function renderTracks() {
   if (!map || !trackByDay.size) return;
 
+  // All track geometry is drawn on one shared canvas renderer: no per-point
+  // SVG/DOM nodes, and Leaflet hit-tests the canvas against layer data so
+  // the per-point tooltips keep working.
+  if (!trackRenderer) trackRenderer = L.canvas({ padding: 0.3 });
+
   // Clear previous track layers.
   if (!trackMarkers) {
     trackMarkers = L.layerGroup().addTo(map);
@@ -397,20 +672,28 @@ function renderTracks() {
   // Draw older tracks first (pale white) so coloured recent tracks appear on top.
   if (olderDays.length) {
     const segments = olderDays.map((day) =>
-      trackByDay.get(day).map((p) => [p.latitude, p.longitude])
+      trackPointsForDay(day).map((p) => [p.latitude, p.longitude])
     );
-    olderTrackLayer = L.polyline(segments, { color: '#ffffff', weight: 2, opacity: 0.35 }).addTo(map);
+    olderTrackLayer = L.polyline(segments, {
+      color: '#ffffff', weight: 2, opacity: 0.35, renderer: trackRenderer,
+    }).addTo(map);
   }
 
   // Draw recent tracks with per-day colours, oldest-to-newest so newest is on top.
+  // Markers share a fixed budget across days so pan/zoom cost stays flat no
+  // matter how much history is loaded; the polylines keep full detail.
+  const perDayMarkerBudget = Math.max(
+    30, Math.floor(C.TRACK_MARKER_BUDGET / Math.max(1, recentDays.length)));
   const lines = [];
   [...recentDays].reverse().forEach((day) => {
     const idx = recentDays.indexOf(day);
     const color = DAY_TRACK_COLORS[idx % DAY_TRACK_COLORS.length];
-    const pts = trackByDay.get(day);
+    const pts = trackPointsForDay(day);
     const latlngs = pts.map((p) => [p.latitude, p.longitude]);
-    lines.push(L.polyline(latlngs, { color, weight: 3, opacity: 0.8 }).addTo(map));
-    pts.forEach((point) => {
+    lines.push(L.polyline(latlngs, {
+      color, weight: 3, opacity: 0.8, renderer: trackRenderer,
+    }).addTo(map));
+    thinTrackPoints(pts, perDayMarkerBudget).forEach((point) => {
       const timeLabel = point.timestamp ? new Date(point.timestamp).toLocaleString() : 'N/A';
       const speedLabel = Number.isFinite(point.speedOverGround)
         ? `${(point.speedOverGround * 1.94384).toFixed(1)} kts` : 'N/A';
@@ -423,6 +706,7 @@ function renderTracks() {
         fillColor: color,
         fillOpacity: 0.7,
         weight: 1,
+        renderer: trackRenderer,
       }).bindTooltip(tooltipHtml, { direction: 'top', opacity: 0.9 }).addTo(trackMarkers);
     });
   });
@@ -557,6 +841,75 @@ async function loadTrack() {
   }
 }
 
+// ── Parse worker ───────────────────────────────────────────────────────────
+// GPX parsing and series building run in assets/track-worker.js so long
+// tracks don't freeze the map. Jobs are id-tagged promises; job.cancel()
+// tells the worker to drop the result. Falls back to the main-thread parsers
+// when workers are unavailable (file:// pages, very old browsers).
+let trackWorker = null; // null = not started, false = unavailable
+let trackWorkerSeq = 0;
+const trackWorkerPending = new Map();
+
+function getTrackWorker() {
+  if (trackWorker !== null) return trackWorker;
+  try {
+    trackWorker = new Worker('assets/track-worker.js');
+    trackWorker.onmessage = (event) => {
+      const { id, ...result } = event.data || {};
+      const pending = trackWorkerPending.get(id);
+      if (!pending) return; // cancelled after completion
+      trackWorkerPending.delete(id);
+      pending.resolve(result);
+    };
+    trackWorker.onerror = () => {
+      for (const pending of trackWorkerPending.values()) {
+        pending.reject(new Error('track worker failed'));
+      }
+      trackWorkerPending.clear();
+      trackWorker = false; // callers fall back to main-thread parsing
+    };
+  } catch {
+    trackWorker = false;
+  }
+  return trackWorker;
+}
+
+function trackWorkerJob(type, payload) {
+  const worker = getTrackWorker();
+  if (!worker) return null;
+  const id = ++trackWorkerSeq;
+  const promise = new Promise((resolve, reject) => {
+    trackWorkerPending.set(id, { resolve, reject });
+  });
+  worker.postMessage({ id, type, ...payload });
+  promise.cancel = () => {
+    trackWorkerPending.delete(id);
+    worker.postMessage({ type: 'cancel', id });
+  };
+  return promise;
+}
+
+async function parseGpxTextAsync(gpxText) {
+  const job = trackWorkerJob('gpx', { text: gpxText });
+  if (job) {
+    try {
+      const { lat, lon, ts, sog, cog } = await job;
+      const points = new Array(lat.length);
+      for (let i = 0; i < lat.length; i++) {
+        points[i] = {
+          latitude: lat[i],
+          longitude: lon[i],
+          timestamp: Number.isFinite(ts[i]) ? new Date(ts[i]).toISOString() : null,
+          speedOverGround: sog[i],
+          courseOverGroundTrue: cog[i],
+        };
+      }
+      return points;
+    } catch { /* worker unavailable — parse inline below */ }
+  }
+  return parseGpxText(gpxText);
+}
+
 function parseGpxText(gpxText) {
   const parser = new DOMParser();
   const doc = parser.parseFromString(gpxText, 'application/xml');
@@ -584,6 +937,174 @@ function parseGpxText(gpxText) {
   return points;
 }
 
+/**
+ * Decode a packed columnar archive day file (see scripts/telemetry_archive.py).
+ * Little-endian, 40-byte records: f64 ts, f64 lat, f64 lon, f32 sog,
+ * f32 cog, f32 windSpeed, f32 windAngle. NaN marks missing values.
+ */
+function decodeArchiveDay(buffer) {
+  const view = new DataView(buffer);
+  const recordSize = C.ARCHIVE_RECORD_SIZE;
+  const points = [];
+  for (let off = 0; off + recordSize <= buffer.byteLength; off += recordSize) {
+    const ts = view.getFloat64(off, true);
+    points.push({
+      latitude: view.getFloat64(off + 8, true),
+      longitude: view.getFloat64(off + 16, true),
+      timestamp: new Date(ts * 1000).toISOString(),
+      speedOverGround: view.getFloat32(off + 24, true),
+      courseOverGroundTrue: view.getFloat32(off + 28, true),
+    });
+  }
+  return points;
+}
+
+// Archive index (days available as packed binary) — loaded once, lazily.
+let archiveDays = null;
+async function loadArchiveIndex() {
+  if (archiveDays) return archiveDays;
+  archiveDays = new Map();
+  try {
+    const resp = await fetch(`${C.ARCHIVE_INDEX_URL}?ts=${Date.now()}`);
+    if (resp.ok) {
+      const index = await resp.json();
+      (index.days ?? []).forEach((d) => archiveDays.set(d.date, d.file));
+    }
+  } catch { /* archive not published yet — GPX fallback covers it */ }
+  return archiveDays;
+}
+
+// Parse compact [lat, lon, ts, speed_ms, course_rad] LOD rows into the same
+// point shape parseGpxText produces.
+function parseLodRows(rows) {
+  return rows
+    .map((row) => ({
+      latitude: Number(row[0]),
+      longitude: Number(row[1]),
+      timestamp: row[2] ?? null,
+      speedOverGround: row[3] != null ? Number(row[3]) : NaN,
+      courseOverGroundTrue: row[4] != null ? Number(row[4]) : NaN,
+    }))
+    .filter((p) => Number.isFinite(p.latitude)
+      && Number.isFinite(p.longitude)
+      && !isInPrivacyZone(p.latitude, p.longitude));
+}
+
+function localDayKey(timestamp) {
+  const dt = new Date(timestamp);
+  return `${dt.getFullYear()}-${String(dt.getMonth() + 1).padStart(2, '0')}-${String(dt.getDate()).padStart(2, '0')}`;
+}
+
+// Register a fetched .lod.json payload: group each level by local calendar
+// day (same keying as loadTrack) and seed trackByDay with the fine level so
+// legend counts and bounds checks keep working. Returns true when new days
+// were added.
+function registerTrackLod(lod) {
+  const byDay = {};
+  for (const [name, rows] of Object.entries(lod.levels ?? {})) {
+    for (const p of parseLodRows(rows)) {
+      if (!p.timestamp) continue;
+      const dayKey = localDayKey(p.timestamp);
+      if (!byDay[dayKey]) byDay[dayKey] = {};
+      if (!byDay[dayKey][name]) byDay[dayKey][name] = [];
+      byDay[dayKey][name].push(p);
+    }
+  }
+  let added = false;
+  for (const [dayKey, levels] of Object.entries(byDay)) {
+    trackLodByDay.set(dayKey, levels);
+    if (!trackByDay.has(dayKey)) {
+      trackByDay.set(dayKey, levels.fine ?? levels.medium ?? levels.coarse ?? []);
+      added = true;
+    }
+  }
+  return added;
+}
+
+// Monthly archive pages of positions-index entries pruned from the head
+// index, fetched on demand (see _archive_position_entries on the Pi).
+let positionPagesManifest = null;
+const positionPageCache = new Map();
+async function loadPositionPage(month) {
+  if (positionPageCache.has(month)) return positionPageCache.get(month);
+  if (!positionPagesManifest) {
+    try {
+      const r = await fetch(`${C.POSITION_PAGES_MANIFEST_URL}?ts=${Date.now()}`);
+      positionPagesManifest = r.ok ? ((await r.json()).pages ?? []) : [];
+    } catch {
+      positionPagesManifest = [];
+    }
+  }
+  const page = positionPagesManifest.find((p) => p.month === month);
+  let positions = [];
+  if (page) {
+    try {
+      const r = await fetch(`${C.POSITION_PAGES_DIR}/${page.file}?ts=${Date.now()}`);
+      if (r.ok) positions = (await r.json()).positions ?? [];
+    } catch { /* offline — caller falls back to whatever it has */ }
+  }
+  positionPageCache.set(month, positions);
+  return positions;
+}
+
+// Upgrade LOD-only days intersecting the viewport to full resolution.
+// Runs when the user zooms in past TRACK_FULL_RES_ZOOM.
+const fullResFetched = new Set();
+async function ensureFullResTracks() {
+  if (!map || !trackLodByDay.size) return;
+  const bounds = map.getBounds();
+  const candidates = [...trackLodByDay.keys()].filter((day) =>
+    !fullResFetched.has(day)
+    && (trackByDay.get(day) ?? []).some((p) => bounds.contains([p.latitude, p.longitude])));
+  if (!candidates.length) return;
+
+  await loadArchiveIndex();
+  let added = false;
+  for (const day of candidates) {
+    fullResFetched.add(day);
+    const track = tracksIndex.find((t) => {
+      if (t.date === day) return true;
+      return t.start ? localDayKey(t.start) === day : false;
+    });
+    if (!track) continue;
+    let points = null;
+    const archiveFile = archiveDays?.get(track.date);
+    if (archiveFile) {
+      try {
+        const r = await fetch(`${C.ARCHIVE_DIR_URL}/${archiveFile}?ts=${Date.now()}`);
+        if (r.ok) points = decodeArchiveDay(await r.arrayBuffer());
+      } catch { /* fall through to GPX */ }
+    }
+    if (!points) {
+      try {
+        const r = await fetch(`data/telemetry/${track.file}?ts=${Date.now()}`);
+        if (r.ok) points = await parseGpxTextAsync(await r.text());
+      } catch { /* offline — keep drawing the LOD level */ }
+    }
+    if (!points || !points.length) {
+      // Last resort: the monthly positions-index archive page for that day.
+      const pagePositions = await loadPositionPage(track.date.slice(0, 7));
+      points = pagePositions
+        .map(parsePositionPoint)
+        .filter((p) => p && p.timestamp && String(p.timestamp).slice(0, 10) === track.date);
+    }
+    if (!points || !points.length) continue;
+    const clean = points.filter((p) => !isInPrivacyZone(p.latitude, p.longitude));
+    for (const p of clean) {
+      if (!p.timestamp) continue;
+      const dayKey = localDayKey(p.timestamp);
+      if (trackLodByDay.has(dayKey)) {
+        trackByDay.set(dayKey, []);
+        trackLodByDay.delete(dayKey);
+      }
+      if (!trackByDay.has(dayKey)) trackByDay.set(dayKey, []);
+      trackByDay.get(dayKey).push(p);
+      added = true;
+    }
+  }
+  if (added) renderTracks();
+}
+
 async function loadHistoricalTracks() {
   try {
     const resp = await fetch(`data/telemetry/tracks_index.json?ts=${Date.now()}`);
@@ -595,6 +1116,8 @@ async function loadHistoricalTracks() {
     return;
   }
 
+  await loadArchiveIndex();
+
   // Fetch all GPX files in parallel, skip days already covered by positions_index.
   const covered = new Set(trackByDay.keys());
   const toFetch = tracksIndex.filter((track) => {
@@ -608,7 +1131,24 @@ async function loadHistoricalTracks() {
 
   if (!toFetch.length) return;
 
+  const today = new Date().toISOString().slice(0, 10);
   const results = await Promise.all(toFetch.map(async (track) => {
+    // Past days: the multi-resolution LOD file is the cheapest option — the
+    // full track is only fetched later if the user zooms right in.
+    if (track.date !== today && track.lod) {
+      try {
+        const r = await fetch(`data/telemetry/${track.lod}?ts=${Date.now()}`);
+        if (r.ok) return { track, lod: await r.json() };
+      } catch { /* fall through to archive/GPX */ }
+    }
+    // Next preference: the packed columnar archive (one small binary fetch).
+    const archiveFile = track.date !== today ? archiveDays.get(track.date) : null;
+    if (archiveFile) {
+      try {
+        const r = await fetch(`${C.ARCHIVE_DIR_URL}/${archiveFile}?ts=${Date.now()}`);
+        if (r.ok) return { track, points: decodeArchiveDay(await r.arrayBuffer()) };
+      } catch { /* fall through to GPX */ }
+    }
     try {
       const r = await fetch(`data/telemetry/${track.file}?ts=${Date.now()}`);
       if (!r.ok) return null;
@@ -621,7 +1161,14 @@ async function loadHistoricalTracks() {
   let added = false;
   for (const result of results) {
     if (!result) continue;
-    const points = parseGpxText(result.text);
+    if (result.lod) {
+      if (registerTrackLod(result.lod)) added = true;
+      continue;
+    }
+    // Archive days store zone-center coords for redacted points; drop them
+    // here just like the GPX writer does on the Pi.
+    const points = (result.points ?? await parseGpxTextAsync(result.text))
+      .filter((p) => !isInPrivacyZone(p.latitude, p.longitude));
     if (!points.length) continue;
     // Group by local calendar day (same logic as loadTrack)
     for (const p of points) {
@@ -647,14 +1194,13 @@ function getAllStations() {
 }
 
 let tideChartInstance = null;
-let polarChartInstance = null;
-let polarData = null;
-let activePolarSource = 'estimated'; // 'estimated' | 'calculated'
+// Static-layer cache for the tide chart: while the station, prediction
+// window, and theme are unchanged, refresh ticks only move the "Now" marker
+// dataset instead of rebuilding axes and the prediction curve.
+let tideChartStaticKey = null;
 let currentEnv = null; // Global environment data
 let currentNav = null; // Global navigation data
 let currentPropulsion = null; // Global propulsion data
-let isDrawingPolarChart = false; // Flag to prevent multiple simultaneous chart draws
-let lastPolarChartUpdate = 0; // Timestamp of last chart update
 const SNAPSHOT_INDEX_URL = C.SNAPSHOT_INDEX_URL;
 const SPARKLINE_POINTS = C.SPARKLINE_POINTS;
 let seriesByPath = null;
@@ -787,10 +1333,49 @@ function resolveTidePosition(currentLat, currentLon) {
 
 // ── Voyage statistics ────────────────────────────────────────────────────────
 
+function renderVoyageStatsGrid(panel, items) {
+  const grid = document.getElementById('voyage-stats-grid');
+  if (!grid) return;
+  grid.innerHTML = items.map(({ label, value }) => `
+      <div class="info-item">
+        <div class="label">${label}</div>
+        <div class="value">${value}</div>
+      </div>`).join('');
+  panel.style.display = '';
+}
+
 async function loadVoyageStats() {
   const panel = document.getElementById('voyage-stats-panel');
   if (!panel) return;
 
+  const fmt = (d) => d ? new Date(`${d}T12:00:00`).toLocaleDateString([], { month: 'short', day: 'numeric', year: 'numeric' }) : '—';
+
+  // Preferred source: the Pi-side rollup — lifetime aggregates in one tiny
+  // fetch, including engine hours and average speed the tracks index can't
+  // provide. The derivation below stays as a fallback for stale deploys.
+  try {
+    const resp = await fetch(`${C.VOYAGE_STATS_URL}?ts=${Date.now()}`);
+    if (resp.ok) {
+      const stats = await resp.json();
+      const t = stats?.totals;
+      if (t && t.sailing_days > 0) {
+        renderVoyageStatsGrid(panel, [
+          { label: 'Sailing Days',   value: t.sailing_days },
+          { label: 'Total Distance', value: `${(t.distance_nm ?? 0).toFixed(1)} nm` },
+          { label: 'Total Underway', value: `${(t.underway_hours ?? 0).toFixed(1)} hr` },
+          { label: 'Engine Hours',   value: `${(t.engine_hours ?? 0).toFixed(1)} hr` },
+          { label: 'Top Speed',      value: `${(t.max_speed_kts ?? 0).toFixed(1)} kts` },
+          { label: 'Avg Speed',      value: `${(t.avg_speed_kts ?? 0).toFixed(1)} kts` },
+          { label: 'First Sail',     value: fmt(t.first_sail) },
+          { label: 'Last Sail',      value: fmt(t.last_sail) },
+        ]);
+        return;
+      }
+    }
+  } catch (e) {
+    console.warn('Voyage stats rollup unavailable, deriving from tracks index:', e);
+  }
+
   try {
     const resp = await fetch(`${C.TRACKS_INDEX_URL}?ts=${Date.now()}`);
     if (!resp.ok) { panel.style.display = 'none'; return; }
@@ -805,25 +1390,14 @@ async function loadVoyageStats() {
     const firstDate     = tracks[0]?.date ?? '';
     const lastDate      = tracks[tracks.length - 1]?.date ?? '';
 
-    const fmt = (d) => d ? new Date(`${d}T12:00:00`).toLocaleDateString([], { month: 'short', day: 'numeric', year: 'numeric' }) : '—';
-
-    const grid = document.getElementById('voyage-stats-grid');
-    if (!grid) return;
-
-    grid.innerHTML = [
+    renderVoyageStatsGrid(panel, [
       { label: 'Sailing Days',   value: totalDays },
       { label: 'Total Distance', value: `${totalNm.toFixed(1)} nm` },
       { label: 'Total Underway', value: `${totalHours.toFixed(1)} hr` },
       { label: 'Top Speed',      value: `${maxSpeed.toFixed(1)} kts` },
       { label: 'First Sail',     value: fmt(firstDate) },
       { label: 'Last Sail',      value: fmt(lastDate) },
-    ].map(({ label, value }) => `
-      <div class="info-item">
-        <div class="label">${label}</div>
-        <div class="value">${value}</div>
-      </div>`).join('');
-
-    panel.style.display = '';
+    ]);
   } catch (e) {
     console.warn('Voyage stats unavailable:', e);
     panel.style.display = 'none';
@@ -833,7 +1407,8 @@ async function loadVoyageStats() {
 // Load vessel information from YAML file
 async function loadVesselData() {
   try {
-    const response = await fetch('data/vessel/info.yaml');
+    const { notModified, response } = await conditionalFetch('data/vessel/info.yaml');
+    if (notModified && vesselData) return;
     if (!response.ok) {
       throw new Error(`HTTP error! status: ${response.status}`);
     }
@@ -877,7 +1452,8 @@ async function loadVesselData() {
 // Load tide stations information from JSON file
 async function loadTideStations() {
   try {
-    const response = await fetch('data/tide_stations.json');
+    const { notModified, response } = await conditionalFetch('data/tide_stations.json');
+    if (notModified && tideStations) return;
     if (!response.ok) {
       throw new Error(`HTTP error! status: ${response.status}`);
     }
@@ -976,6 +1552,47 @@ function updateVesselLinks() {
 let themeChangeTimeout = null; // Timeout for theme change debouncing
 let isThemeChanging = false; // Flag to prevent multiple theme changes
 
+// Grid-bucket station lookup. The Pi embeds a lat/lon cell index in
+// data/tide_stations.json (scripts/build_tide_station_index.py); probing the
+// cell containing the position plus expanding neighbor rings keeps the
+// lookup constant-time however many stations the file grows to.
+function stationGridKey(latIdx, lonIdx) {
+  return `${latIdx}:${lonIdx}`;
+}
+
+function nearestStationFromGrid(lat, lon) {
+  const grid = tideStations?.grid;
+  const stations = getAllStations();
+  if (!grid?.cells || !(grid.cell_deg > 0) || stations.length === 0) return null;
+  const cell = grid.cell_deg;
+  const latIdx = Math.floor(lat / cell);
+  const lonIdx = Math.floor(lon / cell);
+  const maxRing = Math.ceil(360 / cell); // worst case sweeps every cell
+  let best = null;
+  let bestDist = Infinity;
+  let foundRing = -1;
+  for (let ring = 0; ring <= maxRing; ring++) {
+    // A station one ring further out can still beat a corner hit in the
+    // ring where we first found one, so probe exactly one extra ring.
+    if (foundRing >= 0 && ring > foundRing + 1) break;
+    for (let di = -ring; di <= ring; di++) {
+      for (let dj = -ring; dj <= ring; dj++) {
+        if (Math.max(Math.abs(di), Math.abs(dj)) !== ring) continue;
+        const bucket = grid.cells[stationGridKey(latIdx + di, lonIdx + dj)];
+        if (!bucket) continue;
+        for (const idx of bucket) {
+          const station = stations[idx];
+          if (!station) continue;
+          const d = haversine(lat, lon, station.lat, station.lon);
+          if (d < bestDist) { bestDist = d; best = station; }
+        }
+      }
+    }
+    if (best && foundRing < 0) foundRing = ring;
+  }
+  return best;
+}
+
 // Find nearest NOAA tide station from lat/lon
 // Uses local lookup table (fast and reliable)
 // Prioritizes known-working stations for certain areas
@@ -984,7 +1601,7 @@ async function findNearestNOAAStation(lat, lon) {
   if (!stations || stations.length === 0) {
     throw new Error('No tide stations available in lookup table');
   }
-  
+
   // For San Francisco Bay area, prefer San Francisco station (9414290) which reliably supports predictions
   // South Beach Harbor and most SF locations should use SF station
   const isSFBayArea = lat >= 37.7 && lat <= 37.9 && lon >= -122.5 && lon <= -122.3;
@@ -995,15 +1612,73 @@ async function findNearestNOAAStation(lat, lon) {
       return sfStation;
     }
   }
-  
-  // For other areas, find nearest station using haversine distance
+
+  const fromGrid = nearestStationFromGrid(lat, lon);
+  if (fromGrid) return fromGrid;
+
+  // No grid index in the data file — fall back to the full linear scan.
   const nearest = stations.reduce((a, b) =>
     haversine(lat, lon, a.lat, a.lon) < haversine(lat, lon, b.lat, b.lon) ? a : b
   );
-  
+
   return nearest;
 }
 
+// Committed 7-day tide-prediction bundle written by the Pi (see
+// scripts/prefetch_tide_predictions.py). Returns null when missing or older
+// than TIDE_BUNDLE_MAX_AGE_MS, in which case callers fall back to live NOAA.
+let tideBundlePromise = null;
+async function loadTideBundle() {
+  if (!tideBundlePromise) {
+    tideBundlePromise = (async () => {
+      try {
+        const r = await fetch(`${C.TIDE_BUNDLE_URL}?ts=${Date.now()}`);
+        if (!r.ok) return null;
+        const bundle = await r.json();
+        const age = Date.now() - new Date(bundle.generated ?? 0).getTime();
+        return Number.isFinite(age) && age < C.TIDE_BUNDLE_MAX_AGE_MS ? bundle : null;
+      } catch {
+        return null;
+      }
+    })();
+  }
+  return tideBundlePromise;
+}
+
+function bundlePredictionsForStation(bundle, stationId) {
+  const station = bundle?.stations?.find((s) => s.id === String(stationId));
+  return station?.predictions?.length ? station.predictions : null;
+}
+
+// Committed Open-Meteo forecast bundle written by the Pi (see
+// scripts/prefetch_forecast_bundle.py). Returns null when missing, stale, or
+// fetched for a position far from (lat, lon) — callers then fall back to the
+// live weather APIs.
+let forecastBundlePromise = null;
+async function loadForecastBundle(lat, lon) {
+  if (!forecastBundlePromise) {
+    forecastBundlePromise = (async () => {
+      try {
+        const r = await fetch(`${C.FORECAST_BUNDLE_URL}?ts=${Date.now()}`);
+        if (!r.ok) return null;
+        const bundle = await r.json();
+        const age = Date.now() - new Date(bundle.generated ?? 0).getTime();
+        return Number.isFinite(age) && age < C.FORECAST_BUNDLE_MAX_AGE_MS ? bundle : null;
+      } catch {
+        return null;
+      }
+    })();
+  }
+  const bundle = await forecastBundlePromise;
+  if (!bundle) return null;
+  if (Number.isFinite(lat) && Number.isFinite(lon)
+      && Number.isFinite(bundle.latitude) && Number.isFinite(bundle.longitude)
+      && haversineMeters(lat, lon, bundle.latitude, bundle.longitude) > C.FORECAST_BUNDLE_MAX_DISTANCE_M) {
+    return null;
+  }
+  return bundle;
+}
+
 async function drawTideGraph(lat, lon, tidePositionMeta = {}) {
   const {
     usingFallback = false,
@@ -1074,8 +1749,17 @@ async function drawTideGraph(lat, lon, tidePositionMeta = {}) {
 
   try {
     let res;
-    // Serve from cache if fresh — tide predictions don't change within a day
-    let json = (() => { const c = getCached(tideCacheKey, C.TIDE_CACHE_TTL_MS); return c ? { predictions: c } : null; })();
+    // Committed bundle first — no NOAA call at all while it is fresh.
+    let json = null;
+    const bundle = await loadTideBundle();
+    const bundled = bundlePredictionsForStation(bundle, targetStation.id);
+    if (bundled) json = { predictions: bundled };
+
+    // Then the local cache — tide predictions don't change within a day
+    if (!json) {
+      const cached = await getCached(tideCacheKey, C.TIDE_CACHE_TTL_MS);
+      if (cached) json = { predictions: cached };
+    }
 
     // Try primary station (skipped when cache hit)
     if (!json) console.debug('Tide fetch: attempting station', {
@@ -1203,6 +1887,18 @@ async function drawTideGraph(lat, lon, tidePositionMeta = {}) {
       }
     });
 
+    const isDark = isDarkTheme(document.documentElement.getAttribute('data-theme'));
+
+    // Cheap path: same station, same prediction points, same theme — the
+    // rendered curve and axes are still valid, so just move the Now marker.
+    const staticKey = `${targetStation.id}|${begin}|${isDark}|${heights.length}`;
+    if (tideChartInstance && tideChartStaticKey === staticKey) {
+      const nowDataset = tideChartInstance.data.datasets[1];
+      nowDataset.data = heights.map((v, i) => (i === currentIndex ? v : null));
+      tideChartInstance.update('none');
+      return;
+    }
+
     const canvas = document.getElementById('tideChart');
     canvas.height = 250;
     const ctx = canvas.getContext('2d');
@@ -1211,8 +1907,6 @@ async function drawTideGraph(lat, lon, tidePositionMeta = {}) {
       tideChartInstance.destroy();
     }
 
-    const isDark = isDarkTheme(document.documentElement.getAttribute('data-theme'));
-
     tideChartInstance = new Chart(ctx, {
       type: 'line',
       data: {
@@ -1301,11 +1995,32 @@ async function drawTideGraph(lat, lon, tidePositionMeta = {}) {
       },
       plugins: [Chart.registry.getPlugin('annotation')]
     });
+    tideChartStaticKey = staticKey;
   } catch (err) {
     console.error("Tide data fetch error:", err);
   }
 }
 
+// Refresh the "Updated X ago" label without a full render — used when a
+// refresh tick gets a 304 and the data itself is unchanged.
+let lastDataTimestamp = null;
+function refreshDataAge() {
+  if (!lastDataTimestamp) return;
+  const ageEl = document.getElementById('status-age');
+  const statusHero = document.getElementById('status-hero');
+  const diffMs = Date.now() - lastDataTimestamp;
+  const s = Math.floor(diffMs / 1000);
+  const m = Math.floor(s / 60);
+  const h = Math.floor(m / 60);
+  const d = Math.floor(h / 24);
+  const label = s < 60 ? 'just now'
+    : m < 60 ? `${m} min ago`
+    : h < 24 ? `${h} hr${h === 1 ? '' : 's'} ago`
+    : `${d} day${d === 1 ? '' : 's'} ago`;
+  if (ageEl) ageEl.textContent = `Updated ${label}`;
+  if (statusHero) statusHero.classList.toggle('stale', diffMs / (1000 * 60 * 60) > 6);
+}
+
 async function loadData() {
 
   function findLatestTimestamp(obj) {
@@ -1375,18 +2090,65 @@ async function loadData() {
   const loadSeries = async () => {
     if (seriesByPath) return seriesByPath;
     if (seriesPromise) return seriesPromise;
-    seriesPromise = fetch(`${C.INSTRUMENT_LOG_URL}?ts=${Date.now()}`)
-      .then((res) => (res.ok ? res.json() : null))
-      .then((payload) => {
-        const entries = Array.isArray(payload?.entries) ? payload.entries : [];
-        const recent = entries.slice(-SPARKLINE_POINTS);
-        seriesByPath = buildSeriesFromLog(recent);
-        return seriesByPath;
-      })
-      .catch(() => {
-        seriesByPath = new Map();
-        return seriesByPath;
-      });
+    seriesPromise = (async () => {
+      // Shard texts are kept raw so the worker can JSON.parse and build the
+      // series off the main thread; the inline fallback parses them here.
+      let texts = [];
+      // Sharded log: fetch only the newest daily shards that cover the
+      // sparkline window instead of the full history.
+      try {
+        const res = await fetch(`${C.INSTRUMENT_LOG_MANIFEST_URL}?ts=${Date.now()}`);
+        if (res.ok) {
+          const manifest = await res.json();
+          const shards = (manifest.shards ?? []).slice().sort((a, b) => (a.date < b.date ? 1 : -1));
+          let needed = SPARKLINE_POINTS;
+          const toFetch = [];
+          for (const shard of shards) {
+            if (needed <= 0) break;
+            toFetch.push(shard);
+            needed -= shard.entries ?? 0;
+          }
+          const payloads = await Promise.all(toFetch.reverse().map((shard) =>
+            fetch(`${C.INSTRUMENT_LOG_SHARD_DIR}/${shard.file}?ts=${Date.now()}`)
+              .then((r) => (r.ok ? r.text() : null))
+              .catch(() => null)));
+          texts = payloads.filter((t) => t != null);
+        }
+      } catch { /* manifest not published yet — single-file fallback below */ }
+      if (!texts.length) {
+        try {
+          const res = await fetch(`${C.INSTRUMENT_LOG_URL}?ts=${Date.now()}`);
+          if (res.ok) texts = [await res.text()];
+        } catch { /* offline — sparklines just stay empty */ }
+      }
+
+      const job = trackWorkerJob('series', { texts, limit: SPARKLINE_POINTS });
+      if (job) {
+        try {
+          const { paths, times, values } = await job;
+          const map = new Map();
+          paths.forEach((path, i) => {
+            const t = times[i];
+            const v = values[i];
+            const list = new Array(t.length);
+            for (let j = 0; j < t.length; j++) list[j] = { t: new Date(t[j]), v: v[j] };
+            map.set(path, list);
+          });
+          seriesByPath = map;
+          return seriesByPath;
+        } catch { /* worker unavailable — build inline below */ }
+      }
+
+      let entries = [];
+      for (const text of texts) {
+        try {
+          const payload = JSON.parse(text);
+          if (Array.isArray(payload?.entries)) entries = entries.concat(payload.entries);
+        } catch { /* corrupt shard — skip it */ }
+      }
+      seriesByPath = buildSeriesFromLog(entries.slice(-SPARKLINE_POINTS));
+      return seriesByPath;
+    })();
     return seriesPromise;
   };
 
@@ -1640,6 +2402,7 @@ async function loadData() {
 
   try {
     console.log('Starting to load data...');
+    const loadStart = performance.now();
     initInlineSparklines(); // kick off async — renders once series data loads
 
     // Load data from local file
@@ -1650,7 +2413,15 @@ async function loadData() {
     try {
       // Local file only
       console.log('Attempting to fetch signalk_latest.json...');
-      res = await fetch('data/telemetry/signalk_latest.json');
+      const conditional = await conditionalFetch('data/telemetry/signalk_latest.json');
+      if (conditional.notModified) {
+        // Nothing aboard has changed since the last render — skip all
+        // parsing and DOM work for this refresh tick.
+        console.log('signalk_latest.json unchanged (304), skipping render');
+        refreshDataAge();
+        return;
+      }
+      res = conditional.response;
       console.log('Local file fetch response:', res.status, res.statusText);
       if (res.ok) {
         data = await res.json();
@@ -1756,6 +2527,7 @@ async function loadData() {
       const diffMs    = Date.now() - modifiedDate;
       const diffHours = diffMs / (1000 * 60 * 60);
       const ageLabel  = formatAge(diffMs);
+      lastDataTimestamp = modifiedDate.getTime();
       if (ageEl) ageEl.textContent = `Updated ${ageLabel}`;
       if (diffHours > 6) {
         bannerState = 'error';
@@ -1802,6 +2574,17 @@ async function loadData() {
         }).bindTooltip('📍 Privacy zone — position not recorded inside this area', {
           sticky: true, opacity: 0.85,
         }).addTo(map);
+
+        // Swap track resolution as the zoom crosses LOD thresholds and
+        // upgrade visible days to full resolution on deep zoom.
+        let lastTrackLodLevel = trackLodLevelForZoom(map.getZoom());
+        map.on('zoomend', () => {
+          const zoom = map.getZoom();
+          if (zoom >= C.TRACK_FULL_RES_ZOOM) ensureFullResTracks();
+          const level = trackLodLevelForZoom(zoom);
+          if (trackLodByDay.size && level !== lastTrackLodLevel) renderTracks();
+          lastTrackLodLevel = level;
+        });
       } else {
         map.setView([lat, lon]);
         marker.setLatLng([lat, lon]);
@@ -1873,8 +2656,8 @@ async function loadData() {
       updateMapLocation(lat, lon).catch(err => console.error('Location fetch error:', err));
       // Load track for last 24 hours
       loadTrack().catch(err => console.error('Track load error:', err));
-      // Update polar performance
-      updatePolarPerformance();
+      // Update polar performance (no-op until the lazy module is in)
+      if (typeof updatePolarPerformance === 'function') updatePolarPerformance();
     } else {
       const sentenceEl = document.getElementById('status-sentence');
       if (sentenceEl) sentenceEl.textContent = 'Waiting for GPS position...';
@@ -1912,7 +2695,7 @@ async function loadData() {
     const tankValueWithBadge = (level, valueDisplay, waste = false, zones = null) =>
       colorValue(valueDisplay, classifyByZones(level, zones) || (waste ? classifyWasteTank(level) : classifyTankLevel(level)));
 
-    document.getElementById('navigation-grid').innerHTML = `
+    renderGrid('navigation-grid', `
       <div class="info-item" title="${withUpdated('Current vessel latitude position', nav.position)}"><div class="label">Latitude</div><div class="value">${lat?.toFixed(6) ?? 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('Current vessel longitude position', nav.position)}"><div class="label">Longitude</div><div class="value">${lon?.toFixed(6) ?? 'N/A'}</div></div>
       <div class="info-item" data-path="navigation.speedOverGround" data-label="SOG" data-unit-group="speed" data-raw="${nav.speedOverGround?.value ?? ''}" title="${withUpdated('Speed Over Ground - actual speed relative to the seabed', nav.speedOverGround)}"><div class="label">SOG</div><div class="value">${fmtUnit('speed', nav.speedOverGround?.value)}</div></div>
@@ -1926,10 +2709,10 @@ async function loadData() {
       <div class="info-item" data-path="steering.rudderAngle" data-label="Rudder Angle" data-unit-group="angle" data-raw="${data.steering?.rudderAngle?.value ?? ''}" title="${withUpdated('Current rudder angle - positive is starboard, negative is port', data.steering?.rudderAngle)}"><div class="label">Rudder Angle</div><div class="value">${fmtUnit('angle', data.steering?.rudderAngle?.value)}</div></div>
       <div class="info-item" data-path="navigation.anchor.currentRadius" data-label="Anchor Distance" data-unit-group="length" data-raw="${nav.anchor?.currentRadius?.value ?? ''}" title="${withUpdated('Distance from anchor position - red if outside safe radius', nav.anchor?.currentRadius)}"><div class="label">Anchor Distance</div>${anchorValueHtml}</div>
       <div class="info-item" data-path="navigation.anchor.bearingTrue" data-label="Anchor Bearing" title="${withUpdated('Bearing to anchor position from current location', nav.anchor?.bearingTrue)}"><div class="label">Anchor Bearing</div><div class="value">${nav.anchor?.bearingTrue?.value ? (nav.anchor.bearingTrue.value * 180 / Math.PI).toFixed(0) + '°' : 'N/A'}</div></div>
-    `;
+    `);
 
     // Update wind data
-    document.getElementById('wind-grid').innerHTML = `
+    renderGrid('wind-grid', `
       <div class="info-item" data-path="environment.wind.speedTrue" data-label="Wind Speed" data-unit-group="speed" data-raw="${env.wind?.speedTrue?.value ?? ''}" title="${withUpdated('True wind speed - actual wind speed in the atmosphere', env.wind?.speedTrue)}"><div class="label">True Wind Speed</div><div class="value">${fmtUnit('speed', env.wind?.speedTrue?.value)}</div></div>
       <div class="info-item" data-path="environment.wind.angleTrue" data-label="Wind Dir" data-unit-group="angle" data-raw="${env.wind?.angleTrue?.value ?? ''}" title="${withUpdated('True wind direction - actual wind direction relative to true north', env.wind?.angleTrue)}"><div class="label">True Wind Dir</div><div class="value">${fmtUnit('angle', env.wind?.angleTrue?.value)}</div></div>
       <div class="info-item" data-path="environment.wind.angleApparent" data-label="Apparent Wind Angle" data-unit-group="angle" data-raw="${data.environment?.wind?.angleApparent?.value ?? ''}" title="${withUpdated('Apparent wind angle - wind direction relative to vessel heading', data.environment?.wind?.angleApparent)}"><div class="label">Apparent Angle</div><div class="value">${fmtUnit('angle', data.environment?.wind?.angleApparent?.value)}</div></div>
@@ -1937,10 +2720,10 @@ async function loadData() {
       <div class="info-item" data-path="environment.wind.oneMinute.gustTrue" data-label="1-Min Gust" data-unit-group="speed" data-raw="${env.wind?.oneMinute?.gustTrue?.value ?? ''}" title="${withUpdated('Maximum true wind gust over the past 1 minute', env.wind?.oneMinute?.gustTrue)}"><div class="label">1-Min Gust</div><div class="value">${fmtUnit('speed', env.wind?.oneMinute?.gustTrue?.value)}</div></div>
       <div class="info-item" data-path="environment.wind.fiveMinutes.gustTrue" data-label="5-Min Gust" data-unit-group="speed" data-raw="${env.wind?.fiveMinutes?.gustTrue?.value ?? ''}" title="${withUpdated('Maximum true wind gust over the past 5 minutes', env.wind?.fiveMinutes?.gustTrue)}"><div class="label">5-Min Gust</div><div class="value">${fmtUnit('speed', env.wind?.fiveMinutes?.gustTrue?.value)}</div></div>
       <div class="info-item" data-path="environment.wind.oneHour.gustTrue" data-label="1-Hour Gust" data-unit-group="speed" data-raw="${env.wind?.oneHour?.gustTrue?.value ?? ''}" title="${withUpdated('Maximum true wind gust over the past 1 hour', env.wind?.oneHour?.gustTrue)}"><div class="label">1-Hour Gust</div><div class="value">${fmtUnit('speed', env.wind?.oneHour?.gustTrue?.value)}</div></div>
-    `;
+    `);
 
     // Update power data
-    document.getElementById('power-grid').innerHTML = `
+    renderGrid('power-grid', `
       <div class="info-item" data-path="electrical.batteries.house.voltage" data-label="Battery Voltage" title="${withUpdated('House battery bank voltage', elec.batteries?.house?.voltage)}"><div class="label">Battery Voltage</div><div class="value">${elec.batteries?.house?.voltage?.value?.toFixed(2) ?? 'N/A'} V</div></div>
       <div class="info-item" data-path="electrical.batteries.house.current" data-label="Battery Current" title="${withUpdated('House battery bank current - positive is charging, negative is discharging', elec.batteries?.house?.current)}"><div class="label">Battery Current</div><div class="value">${elec.batteries?.house?.current?.value?.toFixed(1) ?? 'N/A'} A</div></div>
       <div class="info-item" data-path="electrical.batteries.house.power" data-label="Battery Power" title="${withUpdated('House battery bank power consumption or generation', elec.batteries?.house?.power)}"><div class="label">Battery Power</div><div class="value">${elec.batteries?.house?.power?.value?.toFixed(1) ?? 'N/A'} W</div></div>
@@ -1952,10 +2735,10 @@ async function loadData() {
       <div class="info-item" data-path="electrical.solar.bimini.yieldToday" data-label="Solar Yield Today" title="${withUpdated('Total solar energy generated today from bimini array', elec.solar?.bimini?.yieldToday)}"><div class="label">Solar Yield Today</div><div class="value">${elec.solar?.bimini?.yieldToday?.value != null ? (elec.solar.bimini.yieldToday.value / 3600).toFixed(0) + ' Wh' : 'N/A'}</div></div>
       <div class="info-item" data-path="electrical.batteries.house.capacity.dischargeSinceFull" data-label="Discharge Since Full" title="${withUpdated('Amp-hours drawn from the house bank since last full charge', elec.batteries?.house?.capacity?.dischargeSinceFull)}"><div class="label">Discharge Since Full</div><div class="value">${elec.batteries?.house?.capacity?.dischargeSinceFull?.value != null ? (elec.batteries.house.capacity.dischargeSinceFull.value / 3600).toFixed(1) + ' Ah' : 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('Solar charge controller mode (off / bulk / absorption / float)', elec.solar?.bimini?.chargingMode)}"><div class="label">Solar Mode</div><div class="value value-text">${elec.solar?.bimini?.chargingMode?.value ?? 'N/A'}</div></div>
-    `;
+    `);
 
     // Update the vessel information with static vessel data
-    document.getElementById('vessel-grid').innerHTML = `
+    renderGrid('vessel-grid', `
       <div class="info-item" data-unit-group="length" data-raw="${data.design?.length?.value?.overall ?? ''}" title="${withUpdated('Overall vessel length from bow to stern', data.design?.length)}"><div class="label">Vessel Length</div><div class="value">${fmtUnit('length', data.design?.length?.value?.overall)}</div></div>
       <div class="info-item" data-unit-group="length" data-raw="${data.design?.beam?.value ?? ''}" title="${withUpdated('Vessel beam - maximum width of the vessel', data.design?.beam)}"><div class="label">Vessel Beam</div><div class="value">${fmtUnit('length', data.design?.beam?.value)}</div></div>
       <div class="info-item" data-unit-group="length" data-raw="${data.design?.draft?.value?.maximum ?? ''}" title="${withUpdated('Maximum vessel draft - depth below waterline', data.design?.draft)}"><div class="label">Vessel Draft</div><div class="value">${fmtUnit('length', data.design?.draft?.value?.maximum)}</div></div>
@@ -1965,7 +2748,7 @@ async function loadData() {
       <div class="info-item" title="${withUpdated('VHF radio callsign', data.communication)}"><div class="label">Callsign</div><div class="value value-text">${data.communication?.callsignVhf || 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('Hull Number (Assigned by Beneteau)', vesselData)}"><div class="label">Hull #</div><div class="value value-text">${vesselData?.hull_number || 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('US Coast Guard vessel registration number', vesselData)}"><div class="label">USCG #</div><div class="value value-text">${vesselData?.uscg_number || 'N/A'}</div></div>
-    `;
+    `);
 
     const isNumericValue = (val) => typeof val === 'number' && Number.isFinite(val);
     const toPercent = (val, digits = 0) =>
@@ -1979,7 +2762,7 @@ async function loadData() {
       return levelDisplay !== 'N/A' ? levelDisplay : (volumeDisplay || 'N/A');
     };
     // Update the environment with environmental data
-    document.getElementById('environment-grid').innerHTML = `
+    renderGrid('environment-grid', `
       <div class="info-item" data-path="environment.water.temperature" data-label="Water Temp" data-unit-group="temperature" data-raw="${env.water?.temperature?.value ?? ''}" title="${withUpdated('Water temperature at the surface', env.water?.temperature)}"><div class="label">Water Temp</div><div class="value">${fmtUnit('temperature', env.water?.temperature?.value)}</div></div>
       <div class="info-item" data-path="environment.inside.temperature" data-label="Inside Temp" data-unit-group="temperature" data-raw="${data.environment?.inside?.temperature?.value ?? ''}" title="${withUpdated('Inside air temperature from BME280 sensor', data.environment?.inside?.temperature)}"><div class="label">Inside Temp</div><div class="value">${fmtUnit('temperature', data.environment?.inside?.temperature?.value)}</div></div>
       <div class="info-item" data-path="environment.inside.humidity" data-label="Inside Humidity" title="${withUpdated('Inside humidity from BME280 sensor', data.environment?.inside?.humidity)}"><div class="label">Inside Humidity</div><div class="value">${data.environment?.inside?.humidity?.value ? (data.environment.inside.humidity.value * 100).toFixed(1) + '%' : 'N/A'}</div></div>
@@ -1989,35 +2772,35 @@ async function loadData() {
       <div class="info-item" data-path="navigation.magneticVariation" data-label="Magnetic Variation" title="${withUpdated('Magnetic variation at current position - difference between true and magnetic north', data.navigation?.magneticVariation)}"><div class="label">Magnetic Variation</div><div class="value">${data.navigation?.magneticVariation?.value ? (data.navigation.magneticVariation.value * 180 / Math.PI).toFixed(1) + '°' : 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('Sunrise time today', data.environment?.sunlight?.times?.sunrise)}"><div class="label">Sunrise</div><div class="value">${data.environment?.sunlight?.times?.sunrise?.value ? new Date(data.environment.sunlight.times.sunrise.value).toLocaleTimeString() : 'N/A'}</div></div>
       <div class="info-item" title="${withUpdated('Sunset time today', data.environment?.sunlight?.times?.sunset)}"><div class="label">Sunset</div><div class="value">${data.environment?.sunlight?.times?.sunset?.value ? new Date(data.environment.sunlight.times.sunset.value).toLocaleTimeString() : 'N/A'}</div></div>
-    `;
+    `);
 
-    document.getElementById('internet-grid').innerHTML = `
+    renderGrid('internet-grid', `
       <div class="info-item" title="${withUpdated('Internet service provider', internet.ISP)}"><div class="label">ISP</div><div class="value value-text">${internet.ISP?.value || 'N/A'}</div></div>
       <div class="info-item" data-path="internet.speed.download" data-label="Download" title="${withUpdated('Download speed', internet.speed?.download)}"><div class="label">Download</div><div class="value">${isNumericValue(internet.speed?.download?.value) ? internet.speed.download.value.toFixed(1) + ' Mbps' : 'N/A'}</div></div>
       <div class="info-item" data-path="internet.speed.upload" data-label="Upload" title="${withUpdated('Upload speed', internet.speed?.upload)}"><div class="label">Upload</div><div class="value">${isNumericValue(internet.speed?.upload?.value) ? internet.speed.upload.value.toFixed(1) + ' Mbps' : 'N/A'}</div></div>
       <div class="info-item" data-path="internet.ping.latency" data-label="Latency" title="${withUpdated('Ping latency', internet.ping?.latency)}"><div class="label">Latency</div><div class="value">${isNumericValue(internet.ping?.latency?.value) ? internet.ping.latency.value.toFixed(1) + ' ms' : 'N/A'}</div></div>
       <div class="info-item" data-path="internet.ping.jitter" data-label="Jitter" title="${withUpdated('Ping jitter', internet.ping?.jitter)}"><div class="label">Jitter</div><div class="value">${isNumericValue(internet.ping?.jitter?.value) ? internet.ping.jitter.value.toFixed(1) + ' ms' : 'N/A'}</div></div>
       <div class="info-item" data-path="internet.packetLoss" data-label="Packet Loss" title="${withUpdated('Packet loss percentage', internet.packetLoss)}"><div class="label">Packet Loss</div>${packetLossHtml}</div>
-    `;
+    `);
 
     // Update system health (RPi)
     const rpi = env.rpi || {};
     const fmtCelsius = (k) => Number.isFinite(k) ? `${(k - 273.15).toFixed(1)} °C` : 'N/A';
     const fmtPercent = (v) => Number.isFinite(v) ? `${(v * 100).toFixed(0)}%` : 'N/A';
-    document.getElementById('system-grid').innerHTML = `
+    renderGrid('system-grid', `
       <div class="info-item" data-path="environment.rpi.cpu.temperature" data-label="CPU Temp" data-unit-group="temperature" data-raw="${rpi.cpu?.temperature?.value ?? ''}" title="${withUpdated('Raspberry Pi CPU temperature', rpi.cpu?.temperature)}"><div class="label">CPU Temp</div><div class="value">${fmtCelsius(rpi.cpu?.temperature?.value)}</div></div>
       <div class="info-item" data-path="environment.rpi.gpu.temperature" data-label="GPU Temp" data-unit-group="temperature" data-raw="${rpi.gpu?.temperature?.value ?? ''}" title="${withUpdated('Raspberry Pi GPU temperature', rpi.gpu?.temperature)}"><div class="label">GPU Temp</div><div class="value">${fmtCelsius(rpi.gpu?.temperature?.value)}</div></div>
       <div class="info-item" data-path="environment.rpi.cpu.utilisation" data-label="CPU Use" title="${withUpdated('Raspberry Pi CPU utilisation', rpi.cpu?.utilisation)}"><div class="label">CPU Use</div><div class="value">${fmtPercent(rpi.cpu?.utilisation?.value)}</div></div>
       <div class="info-item" data-path="environment.rpi.memory.utilisation" data-label="RAM Use" title="${withUpdated('Raspberry Pi memory utilisation', rpi.memory?.utilisation)}"><div class="label">RAM Use</div><div class="value">${fmtPercent(rpi.memory?.utilisation?.value)}</div></div>
       <div class="info-item" data-path="environment.rpi.sd.utilisation" data-label="SD Use" title="${withUpdated('Raspberry Pi SD card utilisation', rpi.sd?.utilisation)}"><div class="label">SD Use</div><div class="value">${fmtPercent(rpi.sd?.utilisation?.value)}</div></div>
-    `;
+    `);
 
     const propulsion = data.propulsion?.port || {};
     const rpmValue = propulsion.revolutions?.value;
-    document.getElementById('propulsion-grid').innerHTML = `
+    renderGrid('propulsion-grid', `
       <div class="info-item" title="${withUpdated('Engine state', propulsion.state)}"><div class="label">State</div><div class="value value-text">${propulsion.state?.value || 'N/A'}</div></div>
       <div class="info-item" data-path="propulsion.port.revolutions" data-label="RPM" data-unit-group="rotation" data-raw="${rpmValue ?? ''}" title="${withUpdated('Engine revolutions per minute', propulsion.revolutions)}"><div class="label">RPM</div><div class="value">${fmtUnit('rotation', rpmValue)}</div></div>
-    `;
+    `);
 
     const tanks = data.tanks || {};
     const fuelMain = tanks.fuel?.['0'] || {};
@@ -2028,7 +2811,7 @@ async function loadData() {
     const propaneB = tanks.propane?.b || {};
     const blackwaterBow = tanks.blackwater?.bow || {};
     const liveWell0 = tanks.liveWell?.['0'] || {};
-    document.getElementById('tanks-grid').innerHTML = `
+    renderGrid('tanks-grid', `
       <div class="info-item" data-path="tanks.fuel.0.currentLevel" data-label="Fuel (Main)" data-unit-group="volume" data-raw="${fuelMain.currentVolume?.value ?? ''}" data-level="${toPercent(fuelMain.currentLevel?.value)}" title="${withUpdatedNodes('Main fuel tank level, volume, and temperature (if available)', fuelMain.currentLevel, fuelMain.currentVolume, fuelMain.temperature)}"><div class="label">Fuel (Main)</div>${tankValueWithBadge(fuelMain.currentLevel?.value, formatTankDisplay(fuelMain.currentLevel?.value, fuelMain.currentVolume?.value), false, fuelMain.currentLevel?.meta?.zones)}</div>
       <div class="info-item" data-path="tanks.fuel.reserve.currentLevel" data-label="Fuel (Reserve)" data-unit-group="volume" data-raw="${fuelReserve.currentVolume?.value ?? ''}" data-level="${toPercent(fuelReserve.currentLevel?.value)}" title="${withUpdatedNodes('Reserve fuel tank level, volume, and temperature (if available)', fuelReserve.currentLevel, fuelReserve.currentVolume, fuelReserve.temperature)}"><div class="label">Fuel (Reserve)</div>${tankValueWithBadge(fuelReserve.currentLevel?.value, formatTankDisplay(fuelReserve.currentLevel?.value, fuelReserve.currentVolume?.value), false, fuelReserve.currentLevel?.meta?.zones)}</div>
       <div class="info-item" data-path="tanks.freshWater.0.currentLevel" data-label="Fresh Water 1" data-unit-group="volume" data-raw="${freshWater0.currentVolume?.value ?? ''}" data-level="${toPercent(freshWater0.currentLevel?.value)}" title="${withUpdatedNodes('Fresh water tank 1 level and volume', freshWater0.currentLevel, freshWater0.currentVolume)}"><div class="label">Fresh Water 1</div>${tankValueWithBadge(freshWater0.currentLevel?.value, formatTankDisplay(freshWater0.currentLevel?.value, freshWater0.currentVolume?.value), false, freshWater0.currentLevel?.meta?.zones)}</div>
@@ -2037,11 +2820,14 @@ async function loadData() {
       <div class="info-item" data-path="tanks.propane.b.currentLevel" data-label="Propane B" title="${withUpdatedNodes('Propane tank B level and temperature', propaneB.currentLevel, propaneB.temperature)}"><div class="label">Propane B</div>${tankValueWithBadge(propaneB.currentLevel?.value, formatTankDisplay(propaneB.currentLevel?.value, null), false, propaneB.currentLevel?.meta?.zones)}</div>
       <div class="info-item" data-path="tanks.blackwater.bow.currentLevel" data-label="Blackwater" title="${withUpdatedNodes('Blackwater tank level and temperature', blackwaterBow.currentLevel, blackwaterBow.temperature)}"><div class="label">Blackwater</div>${tankValueWithBadge(blackwaterBow.currentLevel?.value, formatTankDisplay(blackwaterBow.currentLevel?.value, null), true, blackwaterBow.currentLevel?.meta?.zones)}</div>
       <div class="info-item" data-path="tanks.liveWell.0.currentLevel" data-label="Bilge" title="${withUpdated('Bilge level', liveWell0.currentLevel)}"><div class="label">Bilge</div>${tankValueWithBadge(liveWell0.currentLevel?.value, formatTankDisplay(liveWell0.currentLevel?.value, null), true, liveWell0.currentLevel?.meta?.zones)}</div>
-    `;
+    `);
 
-    // Render alert summary and inline sparklines now that all info-item cards are in the DOM.
+    // Wait for the batched rAF flush so the alert summary and sparklines see
+    // the updated info-item cards in the DOM.
+    if (gridFlushPromise) await gridFlushPromise;
     renderAlertSummary();
     initInlineSparklines();
+    perfRecord('loadData total', performance.now() - loadStart);
   } catch (err) {
     console.error("Failed to load data:", err);
     console.error("Error details:", err.message);
@@ -2055,430 +2841,59 @@ async function loadData() {
   }
 }
 
-async function loadPolarData(csvPath = 'data/vessel/polars.csv') {
-  try {
-    const response = await fetch(csvPath);
-
-    if (!response.ok) {
-      throw new Error(`HTTP error! status: ${response.status}`);
-    }
-
-    const csvText = await response.text();
-
-    // Parse CSV data
-    const lines = csvText.split('\n');
-    const headers = lines[0].split(';');
-    const windSpeeds = headers.slice(1).map(Number); // [4, 6, 8, 10, 12, 14, 16, 20, 24]
-
-    polarData = [];
-    for (let i = 1; i < lines.length; i++) {
-      const values = lines[i].split(';');
-      const twa = parseFloat(values[0]); // True Wind Angle
-      if (!isNaN(twa)) {
-        const speeds = values.slice(1).map(v => parseFloat(v) || 0);
-        polarData.push({ twa, speeds });
-      }
-    }
-  } catch (error) {
-    console.error('Error loading polar data:', error);
-    document.getElementById('polar-performance').innerHTML = `
-      <div style="color: #e74c3c;">Error loading polar data: ${error.message}</div>
-    `;
-  }
-}
-
-async function initPolarToggle() {
-  const btn = document.getElementById('polar-source-toggle');
-  if (!btn) return;
-
-  // Check whether calculated polars exist and have any non-zero data.
-  let hasCalculated = false;
-  try {
-    const resp = await fetch('data/vessel/polars_calculated.csv');
-    if (resp.ok) {
-      const text = await resp.text();
-      hasCalculated = text.split('\n').slice(1).some(line => {
-        return line.split(';').slice(1).some(v => parseFloat(v) > 0);
-      });
-    }
-  } catch (_) { /* file not present yet */ }
-
-  if (!hasCalculated) return;
-
-  const updateBtn = () => {
-    if (activePolarSource === 'estimated') {
-      btn.textContent = 'Estimated';
-      btn.title = 'Showing ORC estimated polars — click to switch to your calculated polars';
-    } else {
-      btn.textContent = 'Calculated';
-      btn.title = 'Showing your calculated polars — click to switch to ORC estimated polars';
-    }
-  };
-
-  updateBtn();
-  btn.style.display = '';
-
-  btn.addEventListener('click', async () => {
-    activePolarSource = activePolarSource === 'estimated' ? 'calculated' : 'estimated';
-    const csvPath = activePolarSource === 'calculated'
-      ? 'data/vessel/polars_calculated.csv'
-      : 'data/vessel/polars.csv';
-    await loadPolarData(csvPath);
-    updateBtn();
-    updatePolarPerformance();
-  });
-}
-
-function getPolarSpeed(twa, tws) {
-  if (!polarData) return 0;
-
-  // Find closest wind speed
-  const windSpeeds = [4, 6, 8, 10, 12, 14, 16, 20, 24];
-  let speedIndex = 0;
-
-  // Find the closest wind speed index
-  for (let i = 0; i < windSpeeds.length; i++) {
-    if (tws <= windSpeeds[i]) {
-      speedIndex = i;
-      break;
-    }
-  }
-
-  // If wind speed is higher than all available speeds, use the last one
-  if (speedIndex === 0 && tws > windSpeeds[0]) {
-    speedIndex = windSpeeds.length - 1;
-  }
-
-  // Find closest TWA, but avoid 0° if possible since it has zero speed
-  let closestAngle = polarData[0];
-  let minDiff = Math.abs(twa - polarData[0].twa);
-
-  for (const angle of polarData) {
-    const diff = Math.abs(twa - angle.twa);
-    if (diff < minDiff) {
-      // Prefer non-zero speeds when possible
-      if (angle.twa === 0 && twa > 10) {
-        // Skip 0° angle if we're not very close to it
-        continue;
-      }
-      minDiff = diff;
-      closestAngle = angle;
-    }
+// ── Lazy polar feature module ───────────────────────────────────────────────
+// The polar chart renders below the fold, so its code (assets/polar.js) is
+// injected as a classic script only when the panel first approaches the
+// viewport. Until then updatePolarPerformance()/drawPolarChart() simply don't
+// exist and callers guard with typeof checks.
+const featureScriptPromises = new Map();
+
+function loadFeatureScript(src) {
+  if (!featureScriptPromises.has(src)) {
+    featureScriptPromises.set(src, new Promise((resolve, reject) => {
+      const script = document.createElement('script');
+      script.src = src;
+      script.onload = () => resolve();
+      script.onerror = () => {
+        featureScriptPromises.delete(src);
+        reject(new Error(`Failed to load ${src}`));
+      };
+      document.head.appendChild(script);
+    }));
   }
-
-  return closestAngle.speeds[speedIndex] || 0;
-}
-
-function calculateVMG(bearingToDest, bsp) {
-  // VMG = Boat Speed * cos(angle between boat heading and destination bearing)
-  // This calculates how fast you're progressing toward your destination
-  const angleRad = (bearingToDest * Math.PI) / 180;
-  return bsp * Math.cos(angleRad);
+  return featureScriptPromises.get(src);
 }
 
+let polarModulePromise = null;
 
-function updatePolarPerformance() {
-  if (!polarData) {
-    return;
-  }
-
-  // Check for different wind angle data sources
-  let windAngle = null;
-  if (currentEnv?.wind?.angleTrue?.value) {
-    windAngle = currentEnv.wind.angleTrue.value;
-  } else if (currentEnv?.wind?.angleTrueWater?.value) {
-    windAngle = currentEnv.wind.angleTrueWater.value;
-  } else if (currentEnv?.wind?.angleApparent?.value) {
-    windAngle = currentEnv.wind.angleApparent.value;
-  }
-
-  // Check for different boat speed data sources
-  let boatSpeed = null;
-  if (currentNav?.speedThroughWater?.value) {
-    boatSpeed = currentNav.speedThroughWater.value;
-  } else if (currentNav?.speedOverGround?.value) {
-    boatSpeed = currentNav.speedOverGround.value;
-  }
-
-  // Check for wind speed data
-  let windSpeed = null;
-  if (currentEnv?.wind?.speedTrue?.value) {
-    windSpeed = currentEnv.wind.speedTrue.value;
-  }
-
-  // Use default values if data is missing
-  const twa = windAngle ? windAngle * 180 / Math.PI : 90; // Default to 90 degrees (middle of chart)
-  const bsp = boatSpeed ? boatSpeed * 1.94384 : 0; // Default to 0 knots (center of bullseye)
-  const tws = windSpeed ? windSpeed * 1.94384 : 10; // Default to 10 knots
-
-  const polarSpeed = getPolarSpeed(twa, tws);
-  const performancePercent = polarSpeed > 0 ? (bsp / polarSpeed * 100).toFixed(1) : 0;
-
-  // Engine / propulsion state
-  const engineState = currentPropulsion?.state?.value;
-  const engineHz    = currentPropulsion?.revolutions?.value;
-  const rpm         = engineHz != null ? Math.round(engineHz * 60) : null;
-  const engineOn    = engineState === 'started' || (rpm != null && rpm > 100);
-  const engineColor = engineOn ? '#ef4444' : '#22c55e';
-  const engineLabel = engineOn
-    ? `Running${rpm != null ? ` · ${rpm} RPM` : ''}`
-    : (engineState ? 'Off' : 'N/A');
-
-  // Update performance display
-  const windAngleDisplay = windAngle ? `${twa.toFixed(1)}°` : 'N/A';
-  const boatSpeedDisplay = boatSpeed ? `${bsp.toFixed(1)} kts` : 'N/A';
-  const windSpeedDisplay = windSpeed ? `${tws.toFixed(1)} kts` : 'N/A';
-
-  document.getElementById('polar-performance').innerHTML = `
-    <div><strong>True Wind Angle:</strong> ${windAngleDisplay}</div>
-    <div><strong>True Wind Speed:</strong> ${windSpeedDisplay}</div>
-    <div><strong>Boat Speed:</strong> ${boatSpeedDisplay}</div>
-    <div><strong>Polar Speed:</strong> ${polarSpeed.toFixed(1)} kts</div>
-    <div><strong>Performance:</strong> <span style="color: ${performancePercent >= 95 ? '#27ae60' : performancePercent >= 85 ? '#f39c12' : '#e74c3c'}">${performancePercent}%</span></div>
-    <div><strong>Engine:</strong> <span style="color: ${engineColor}">${engineLabel}</span></div>
-  `;
-
-  // Show/hide motoring badge over the polar chart
-  const indicator = document.getElementById('polar-engine-indicator');
-  if (indicator) {
-    if (engineOn) {
-      indicator.textContent = rpm != null ? `Motoring · ${rpm} RPM` : 'Engine On';
-      indicator.style.display = '';
-    } else {
-      indicator.style.display = 'none';
-    }
+function ensurePolarModule() {
+  if (!polarModulePromise) {
+    polarModulePromise = loadFeatureScript('assets/polar.js?v=3').then(async () => {
+      await loadPolarData();
+      initPolarToggle();
+      updatePolarPerformance();
+    });
   }
-
-  // Always draw polar chart, even with default values
-  drawPolarChart(twa, bsp, tws);
+  return polarModulePromise;
 }
 
-function drawPolarChart(currentTWA, currentSpeed, currentTWS) {
-  const now = Date.now();
-  if (isDrawingPolarChart) {
+function initLazyPolarModule() {
+  const panel = document.getElementById('polarChart')?.closest('.info-panel')
+    || document.getElementById('polar-performance-grid');
+  const start = () => ensurePolarModule().catch(err => console.error('Polar module load error:', err));
+  if (!panel || typeof IntersectionObserver === 'undefined') {
+    start();
     return;
   }
-
-
-  if (!polarData) return;
-
-  // Get theme information early for use throughout the function
-  const isDark = isDarkTheme(document.documentElement.getAttribute('data-theme'));
-
-  isDrawingPolarChart = true;
-  lastPolarChartUpdate = now;
-
-  const canvas = document.getElementById('polarChart');
-  const ctx = canvas.getContext('2d');
-
-  // Ensure previous chart is properly destroyed
-  if (polarChartInstance) {
-    polarChartInstance.destroy();
-    polarChartInstance = null;
-  }
-
-
-
-  // Clear the canvas
-  ctx.clearRect(0, 0, canvas.width, canvas.height);
-
-  // Determine which side to show based on boat course
-  let focusSide = 'starboard'; // default
-  if (currentNav?.courseOverGroundTrue?.value) {
-    const boatCourse = currentNav.courseOverGroundTrue.value * 180 / Math.PI;
-    const windDirection = currentEnv?.wind?.angleTrueWater?.value * 180 / Math.PI;
-
-    // Calculate relative angle to determine tack
-    let relativeAngle = boatCourse - windDirection;
-    if (relativeAngle > 180) relativeAngle -= 360;
-    if (relativeAngle < -180) relativeAngle += 360;
-
-    // Positive = starboard tack, negative = port tack
-    focusSide = relativeAngle > 0 ? 'starboard' : 'port';
-  }
-
-  // Create full 360° angle array.
-  // Labels use sailing sign convention: positive = starboard, negative = port.
-  const fullAngles = [];
-  const fullLabels = [];
-
-  // Starboard side: 0° → +180°
-  for (let i = 0; i <= 180; i += 15) {
-    fullAngles.push(i);
-    fullLabels.push(i === 0 ? '0°' : `+${i}°`);
-  }
-
-  // Port side: -165° → -15° (stored internally as 195°→345° for Chart.js)
-  for (let i = 195; i <= 345; i += 15) {
-    fullAngles.push(i);
-    fullLabels.push(`${i - 360}°`);  // 195→-165, 210→-150, … 345→-15
-  }
-
-  // Create datasets for each wind speed
-  const polarDatasets = [];
-  const windSpeeds = [4, 6, 8, 10, 12, 14, 16, 20, 24];
-
-  // Find the closest wind speed to current wind speed
-  let closestWindSpeedIndex = 0;
-  let minWindSpeedDiff = Math.abs(currentTWS - windSpeeds[0]);
-  for (let i = 1; i < windSpeeds.length; i++) {
-    const diff = Math.abs(currentTWS - windSpeeds[i]);
-    if (diff < minWindSpeedDiff) {
-      minWindSpeedDiff = diff;
-      closestWindSpeedIndex = i;
-    }
-  }
-
-  windSpeeds.forEach((tws, index) => {
-    const speeds = fullAngles.map(angle => {
-      // For angles > 180°, use the mirror angle (360° - angle)
-      const lookupAngle = angle > 180 ? 360 - angle : angle;
-
-      // Find closest angle in polar data
-      let closestAngle = polarData[0];
-      let minDiff = Math.abs(lookupAngle - polarData[0].twa);
-
-      for (const point of polarData) {
-        const diff = Math.abs(lookupAngle - point.twa);
-        if (diff < minDiff) {
-          minDiff = diff;
-          closestAngle = point;
-        }
-      }
-
-      return closestAngle.speeds[index] || 0;
-    });
-
-    const validSpeeds = speeds.filter(speed => speed > 0);
-    if (validSpeeds.length > 0) {
-      // Reverse the color order: red for max wind, blue for min wind
-      const reversedIndex = windSpeeds.length - 1 - index;
-      const hue = reversedIndex * 30; // 0 = red, 30 = orange, 60 = yellow, 120 = green, 180 = cyan, 240 = blue
-
-      // Highlight the closest wind speed line
-      const isClosestWindSpeed = index === closestWindSpeedIndex;
-
-      polarDatasets.push({
-        label: `${tws} kts${isClosestWindSpeed ? ' (Current)' : ''}`,
-        data: speeds,
-        borderColor: isClosestWindSpeed ? (isDark ? '#60a5fa' : '#2563eb') : `hsla(${hue}, 70%, 50%, 0.50)`, // 50% alpha for non-current lines
-        backgroundColor: isClosestWindSpeed ? (isDark ? 'rgba(96,165,250,0.2)' : 'rgba(37,99,235,0.2)') : `hsla(${hue}, 70%, 50%, 0.025)`, // Reduced alpha for background too
-        borderWidth: isClosestWindSpeed ? 4 : 2, // Thicker line for current wind speed
-        fill: false,
-        tension: 0.4,
-        order: isClosestWindSpeed ? 0 : 1 // Current wind speed drawn last (on top)
-      });
-    }
-  });
-
-  // Add current position as a single point
-  // Normalize TWA to 0-360 range
-  let normalizedTWA = currentTWA;
-  while (normalizedTWA < 0) normalizedTWA += 360;
-  while (normalizedTWA >= 360) normalizedTWA -= 360;
-
-  // Find the closest angle in our chart's angle array
-  const closestAngleIndex = fullAngles.reduce((closest, angle, index) => {
-    return Math.abs(angle - normalizedTWA) < Math.abs(fullAngles[closest] - normalizedTWA) ? index : closest;
-  }, 0);
-
-  // Create a dataset with just the single point
-  const currentData = new Array(fullAngles.length).fill(null);
-  currentData[closestAngleIndex] = currentSpeed;
-
-
-
-  // Add current position last so it appears on top
-  polarDatasets.push({
-    label: 'Current',
-    data: currentData,
-    borderColor: isDark ? '#60a5fa' : '#2563eb',
-    backgroundColor: isDark ? '#60a5fa' : '#2563eb',
-    borderWidth: 0, // No line
-    pointRadius: 12,
-    pointHoverRadius: 16,
-    fill: false,
-    tension: 0,
-    showLine: false, // Don't draw lines between points
-    order: -1 // Lower order values are drawn last (on top)
-  });
-
-  // Note: Chart.js radar charts don't support true straight radial lines
-  // The TWA line would need to be implemented as a custom canvas overlay
-  // For now, the current position marker and highlighted wind speed line provide good reference
-
-  let startAngle = 0;
-  let endAngle = 180;
-
-  polarChartInstance = new Chart(ctx, {
-    type: 'radar',
-    data: {
-      labels: fullLabels,
-      datasets: polarDatasets
-    },
-    options: {
-      responsive: true,
-      maintainAspectRatio: false,
-      animation: {
-        duration: 0 // Disable all animations
-      },
-      plugins: {
-        tooltip: {
-          enabled: false
-        },
-        legend: {
-          position: 'top',
-          labels: {
-            usePointStyle: true,
-            color: isDark ? '#ffffff' : '#2c3e50'
-          }
-        }
-      },
-      scales: {
-        r: {
-            beginAtZero: true,
-            grid: {
-              color: isDark ? 'rgba(255, 255, 255, 0.2)' : 'rgba(0, 0, 0, 0.1)'
-            },
-            ticks: {
-              stepSize: 2,
-              color: isDark ? '#ffffff' : '#2c3e50',
-              backdropColor: 'transparent',
-              font: {
-                size: 11,
-                weight: 'bold'
-              }
-            },
-            pointLabels: {
-              color: isDark ? '#ffffff' : '#2c3e50',
-              font: {
-                size: 9,
-              },
-              callback: function(value, index) {
-                return value;
-              }
-            },
-            title: {
-              display: true,
-              text: 'Boat Speed (kts)',
-              color: isDark ? '#ffffff' : '#2c3e50'
-            },
-            startAngle: startAngle,
-            min: 0,
-            max: 12,
-            backgroundColor: 'transparent'
-          }
-        }
+  const observer = new IntersectionObserver((entries) => {
+    if (entries.some((entry) => entry.isIntersecting)) {
+      observer.disconnect();
+      start();
     }
-  });
-
-  isDrawingPolarChart = false;
-
-
+  }, { rootMargin: '300px' }); // begin loading shortly before the panel scrolls in
+  observer.observe(panel);
 }
 
-
-
 // ─────────────────────────────────────────────────────────────────────────
 // Conditions Forecast — 48-hr unified panel
 // ─────────────────────────────────────────────────────────────────────────
@@ -2526,8 +2941,11 @@ async function loadConditionsForecast() {
 
     // ── Atmospheric (Open-Meteo) ──────────────────────────────────────────
     (async () => {
+      // Committed bundle first — one Pi-side fetch serves every viewer.
+      const bundle = await loadForecastBundle(tidePos.lat, tidePos.lon);
+      if (bundle?.atmos?.hourly) return bundle.atmos;
       const key = `cond_atmos2_${latR}_${lonR}_${today}`;
-      const hit = getCached(key, C.FORECAST_CACHE_TTL_MS);
+      const hit = await getCached(key, C.FORECAST_CACHE_TTL_MS);
       if (hit) return hit;
       const url = `https://api.open-meteo.com/v1/forecast` +
         `?latitude=${tidePos.lat}&longitude=${tidePos.lon}` +
@@ -2544,8 +2962,10 @@ async function loadConditionsForecast() {
 
     // ── Marine (Open-Meteo Marine) ────────────────────────────────────────
     (async () => {
+      const bundle = await loadForecastBundle(tidePos.lat, tidePos.lon);
+      if (bundle?.marine?.hourly) return bundle.marine;
       const key = `cond_marine_${latR}_${lonR}_${today}`;
-      const hit = getCached(key, C.FORECAST_CACHE_TTL_MS);
+      const hit = await getCached(key, C.FORECAST_CACHE_TTL_MS);
       if (hit) return hit;
       const url = `https://marine-api.open-meteo.com/v1/marine` +
         `?latitude=${tidePos.lat}&longitude=${tidePos.lon}` +
@@ -2563,8 +2983,15 @@ async function loadConditionsForecast() {
       const station = await findNearestNOAAStation(tidePos.lat, tidePos.lon);
       const begin   = utcDateStr(windowStart);
       const end     = utcDateStr(windowEnd);
+      // Committed bundle first, but only when it covers the window start
+      // (the conditions panel looks 24 h back).
+      const bundled = bundlePredictionsForStation(await loadTideBundle(), station.id);
+      if (bundled) {
+        const first = new Date(bundled[0].t.replace(' ', 'T') + 'Z');
+        if (first <= windowStart) return { station, predictions: bundled };
+      }
       const key     = `cond_tide_${station.id}_${begin}_${end}`;
-      const hit     = getCached(key, C.TIDE_CACHE_TTL_MS);
+      const hit     = await getCached(key, C.TIDE_CACHE_TTL_MS);
       if (hit) return { station, predictions: hit };
       const params = new URLSearchParams({
         product: 'predictions', application: 'vessel-tracker',
@@ -3272,44 +3699,10 @@ function updateChartsForTheme(theme) {
     tideChartInstance.update();
   }
 
-  // Update polar chart - force complete redraw for point labels
-  if (polarData && !isDrawingPolarChart) {
-    // Destroy existing chart if it exists
-    if (polarChartInstance) {
-      polarChartInstance.destroy();
-      polarChartInstance = null;
-    }
-
-    // Use the same logic as updatePolarPerformance for consistency
-    let windAngle = null;
-    if (currentEnv?.wind?.angleTrue?.value) {
-      windAngle = currentEnv.wind.angleTrue.value;
-    } else if (currentEnv?.wind?.angleTrueWater?.value) {
-      windAngle = currentEnv.wind.angleTrueWater.value;
-    } else if (currentEnv?.wind?.angleApparent?.value) {
-      windAngle = currentEnv.wind.angleApparent.value;
-    }
-
-    let boatSpeed = null;
-    if (currentNav?.speedThroughWater?.value) {
-      boatSpeed = currentNav.speedThroughWater.value;
-    } else if (currentNav?.speedOverGround?.value) {
-      boatSpeed = currentNav.speedOverGround.value;
-    }
-
-    let windSpeed = null;
-    if (currentEnv?.wind?.speedTrue?.value) {
-      windSpeed = currentEnv.wind.speedTrue.value;
-    }
-
-    // Use default values if data is missing (same as updatePolarPerformance)
-    const twa = windAngle ? windAngle * 180 / Math.PI : 90;
-    const bsp = boatSpeed ? boatSpeed * 1.94384 : 0;
-    const tws = windSpeed ? windSpeed * 1.94384 : 10;
-
-    // Always draw the chart to ensure it appears
-    drawPolarChart(twa, bsp, tws);
-
+  // Update polar chart - force complete redraw for point labels.
+  // Lives in the lazy polar module; nothing to redraw if it never loaded.
+  if (typeof redrawPolarChartForTheme === 'function') {
+    redrawPolarChartForTheme();
   }
 
   // Staleness class drives status-hero colors via CSS; no inline style needed here.
@@ -3368,6 +3761,7 @@ function updateChartsForTheme(theme) {
 
     document.addEventListener("DOMContentLoaded", async function() {
   primeSkeletons();
+  loadPathManifest();
   // Load vessel data first
   await loadVesselData();
 
@@ -3375,8 +3769,8 @@ function updateChartsForTheme(theme) {
   await loadTideStations();
 
   initDarkMode();
-  loadPolarData();
-  initPolarToggle();
+  initLazyPolarModule();
+  loadBackendTimings();
   loadVoyageStats();
   loadData();
 
@@ -3416,4 +3810,15 @@ function updateChartsForTheme(theme) {
   setInterval(() => {
     loadConditionsForecast().catch(err => console.error('Conditions forecast error:', err));
   }, C.FORECAST_CACHE_TTL_MS);
+
+  // Re-render once when the service worker's background revalidation lands
+  // fresh telemetry (see staleWhileRevalidateData in sw.js).
+  if ('serviceWorker' in navigator) {
+    navigator.serviceWorker.addEventListener('message', (event) => {
+      if (event.data?.type !== 'data-revalidated') return;
+      const path = String(event.data.path ?? '');
+      if (path.endsWith('signalk_latest.json')) loadData();
+      else if (path.endsWith('positions_index.json')) loadTrack();
+    });
+  }
 });
@@ -24,10 +24,17 @@ var VESSEL_CONSTANTS = Object.freeze({
   // ── Cache TTLs (milliseconds) ────────────────────────────────────────────
   FORECAST_CACHE_TTL_MS: 60 * 60 * 1000,      // 1 hour
   TIDE_CACHE_TTL_MS:     3 * 60 * 60 * 1000,  // 3 hours
+  TIDE_BUNDLE_MAX_AGE_MS: 24 * 60 * 60 * 1000,  // bundle older → live NOAA fallback
 
   // ── Data display ─────────────────────────────────────────────────────────
   SPARKLINE_POINTS:           60,   // number of history points per sparkline
   DEFAULT_RECENT_TRACK_COUNT:  3,   // coloured track days shown by default
+  TRACK_MARKER_BUDGET:       300,   // max track point markers drawn across all recent days
+
+  // ── Track level-of-detail (matches TRACK_LOD_TOLERANCES_DEG backend) ─────
+  TRACK_LOD_COARSE_MAX_ZOOM:  9,   // zoom ≤ this draws the coarse level
+  TRACK_LOD_MEDIUM_MAX_ZOOM: 12,   // zoom ≤ this draws the medium level
+  TRACK_FULL_RES_ZOOM:       14,   // zoom ≥ this fetches the full-resolution track
 
   // ── Fallback privacy zone (South Beach Harbor, SF) ───────────────────────
   // Overridden at runtime by privacy_zones in data/vessel/info.yaml.
@@ -41,9 +48,26 @@ var VESSEL_CONSTANTS = Object.freeze({
   DEFAULT_TIDE_LABEL: 'San Francisco Bay',
 
   // ── Data URLs ────────────────────────────────────────────────────────────
+  SIGNALK_PATHS_URL:    'data/signalk_paths.json',  // shared path manifest
+  POLAR_GRID_URL:       'data/vessel/polars_grid.json',  // dense polar lookup grid
   SNAPSHOT_INDEX_URL:   'data/telemetry/snapshots_index.json',  // legacy, kept for reference
+  ARCHIVE_INDEX_URL:    'data/telemetry/archive/archive_index.json',
+  ARCHIVE_DIR_URL:      'data/telemetry/archive',
+  ARCHIVE_RECORD_SIZE:  40,  // must match telemetry_archive.RECORD_SIZE
+  TIDE_BUNDLE_URL:      'data/telemetry/tide_predictions.json',
+  FORECAST_BUNDLE_URL:  'data/telemetry/forecast_bundle.json',  // Pi-prefetched Open-Meteo payloads
+  FORECAST_BUNDLE_MAX_AGE_MS: 2 * 60 * 60 * 1000,  // bundle older → live Open-Meteo fallback
+  FORECAST_BUNDLE_MAX_DISTANCE_M: 25000,  // must match prefetch_forecast_bundle.BUNDLE_MAX_DISTANCE_M
+  LOCATION_URL:         'data/telemetry/location.json',  // Pi-resolved place name
+  LOCATION_MAX_DISTANCE_M: 10000,  // farther than this → committed name is stale
   TRACKS_INDEX_URL:     'data/telemetry/tracks_index.json',
+  VOYAGE_STATS_URL:     'data/telemetry/voyage_stats.json',  // Pi-side lifetime rollup
+  UPDATE_METRICS_URL:   'data/telemetry/update_metrics.json',  // per-cycle stage timings (?debug overlay)
   POSITIONS_INDEX_URL:  'data/telemetry/positions_index.json',
-  INSTRUMENT_LOG_URL:   'data/telemetry/instrument_log.json',
+  POSITION_PAGES_MANIFEST_URL: 'data/telemetry/positions_index_pages/manifest.json',
+  POSITION_PAGES_DIR:          'data/telemetry/positions_index_pages',
+  INSTRUMENT_LOG_URL:   'data/telemetry/instrument_log.json',  // legacy fallback
   INSTRUMENT_LOG_ENTRIES: 120,  // must match backend INSTRUMENT_LOG_ENTRIES
+  INSTRUMENT_LOG_MANIFEST_URL: 'data/telemetry/instrument_log/manifest.json',
+  INSTRUMENT_LOG_SHARD_DIR:    'data/telemetry/instrument_log',
 });
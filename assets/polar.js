@@ -0,0 +1,546 @@
+// Polar performance feature module for the vessel tracker.
+// Split out of app.js so the chart code only parses and executes when the
+// polar panel scrolls into view — app.js injects this script lazily via
+// ensurePolarModule() (see initLazyPolarModule). Loaded as a classic script
+// after utils.js/constants.js/app.js, so it shares their globals: C,
+// isDarkTheme(), and the currentEnv/currentNav/currentPropulsion state that
+// loadData() maintains.
+
+let polarChartInstance = null;
+let polarData = null;
+// Dense polar lookup grid: { twaStep, twsMin, twsStep, cols, values: Float32Array }.
+// Loaded from polars_grid.json (calculated source) or built from the parsed
+// CSV, so getPolarSpeed() is one index computation instead of a row scan.
+let polarGrid = null;
+let activePolarSource = 'estimated'; // 'estimated' | 'calculated'
+let isDrawingPolarChart = false; // Flag to prevent multiple simultaneous chart draws
+let lastPolarChartUpdate = 0; // Timestamp of last chart update
+// Static-layer cache: while this key (theme + data version + highlighted wind
+// speed) is unchanged, update ticks mutate only the live marker dataset and
+// Chart.js repaints over its already-rendered rings and curves, instead of
+// destroying and rebuilding the whole chart every tick.
+let polarChartStaticKey = null;
+let polarDataVersion = 0; // bumped by loadPolarData so the key tracks new data
+
+async function loadPolarData(csvPath = 'data/vessel/polars.csv') {
+  try {
+    const response = await fetch(csvPath);
+
+    if (!response.ok) {
+      throw new Error(`HTTP error! status: ${response.status}`);
+    }
+
+    const csvText = await response.text();
+
+    // Parse CSV data
+    const lines = csvText.split('\n');
+    const headers = lines[0].split(';');
+    const windSpeeds = headers.slice(1).map(Number); // [4, 6, 8, 10, 12, 14, 16, 20, 24]
+
+    polarData = [];
+    for (let i = 1; i < lines.length; i++) {
+      const values = lines[i].split(';');
+      const twa = parseFloat(values[0]); // True Wind Angle
+      if (!isNaN(twa)) {
+        const speeds = values.slice(1).map(v => parseFloat(v) || 0);
+        polarData.push({ twa, speeds });
+      }
+    }
+
+    // Dense lookup grid: precomputed server-side for the calculated source,
+    // built client-side (same bins) for the estimated CSV.
+    polarGrid = null;
+    if (csvPath.includes('polars_calculated')) {
+      try {
+        const gridResp = await fetch(C.POLAR_GRID_URL);
+        if (gridResp.ok) {
+          const grid = await gridResp.json();
+          if (Array.isArray(grid.values) && grid.values.length) {
+            polarGrid = polarGridFromRows(grid.values, {
+              twaStep: grid.twa_step, twsMin: grid.tws_min, twsStep: grid.tws_step,
+            });
+          }
+        }
+      } catch (_) { /* grid not committed yet — build it below */ }
+    }
+    if (!polarGrid) polarGrid = buildPolarGrid(polarData, windSpeeds);
+    polarDataVersion += 1; // curves changed — force a full chart rebuild
+  } catch (error) {
+    console.error('Error loading polar data:', error);
+    document.getElementById('polar-performance').innerHTML = `
+      <div style="color: #e74c3c;">Error loading polar data: ${error.message}</div>
+    `;
+  }
+}
+
+async function initPolarToggle() {
+  const btn = document.getElementById('polar-source-toggle');
+  if (!btn) return;
+
+  // Check whether calculated polars exist and have any non-zero data.
+  let hasCalculated = false;
+  try {
+    const resp = await fetch('data/vessel/polars_calculated.csv');
+    if (resp.ok) {
+      const text = await resp.text();
+      hasCalculated = text.split('\n').slice(1).some(line => {
+        return line.split(';').slice(1).some(v => parseFloat(v) > 0);
+      });
+    }
+  } catch (_) { /* file not present yet */ }
+
+  if (!hasCalculated) return;
+
+  const updateBtn = () => {
+    if (activePolarSource === 'estimated') {
+      btn.textContent = 'Estimated';
+      btn.title = 'Showing ORC estimated polars — click to switch to your calculated polars';
+    } else {
+      btn.textContent = 'Calculated';
+      btn.title = 'Showing your calculated polars — click to switch to ORC estimated polars';
+    }
+  };
+
+  updateBtn();
+  btn.style.display = '';
+
+  btn.addEventListener('click', async () => {
+    activePolarSource = activePolarSource === 'estimated' ? 'calculated' : 'estimated';
+    const csvPath = activePolarSource === 'calculated'
+      ? 'data/vessel/polars_calculated.csv'
+      : 'data/vessel/polars.csv';
+    await loadPolarData(csvPath);
+    updateBtn();
+    updatePolarPerformance();
+  });
+}
+
+function polarGridFromRows(rows, meta) {
+  const cols = rows[0].length;
+  const values = new Float32Array(rows.length * cols);
+  rows.forEach((row, r) => row.forEach((v, c) => { values[r * cols + c] = v || 0; }));
+  return { ...meta, rows: rows.length, cols, values };
+}
+
+function buildPolarGrid(rows, windSpeeds) {
+  // Bilinearly interpolate the parsed CSV onto the same fixed bins the
+  // backend uses for polars_grid.json: TWA 0–180° ×5, TWS 2–30 kts ×1.
+  if (!rows || !rows.length || !windSpeeds || !windSpeeds.length) return null;
+  const twaStep = 5, twsMin = 2, twsMax = 30, twsStep = 1;
+  const sorted = [...rows].sort((a, b) => a.twa - b.twa);
+  const twaVals = sorted.map((r) => r.twa);
+  const interp = (grid, t) => {
+    if (t <= grid[0]) return [0, 0, 0];
+    if (t >= grid[grid.length - 1]) return [grid.length - 1, grid.length - 1, 0];
+    for (let i = 0; i < grid.length - 1; i++) {
+      if (t >= grid[i] && t <= grid[i + 1]) {
+        const span = grid[i + 1] - grid[i];
+        return [i, i + 1, span ? (t - grid[i]) / span : 0];
+      }
+    }
+    return [grid.length - 1, grid.length - 1, 0];
+  };
+  const sp = (row, i) => row.speeds[i] || 0;
+  const outRows = [];
+  for (let twa = 0; twa <= 180; twa += twaStep) {
+    const [a0, a1, fa] = interp(twaVals, twa);
+    const row = [];
+    for (let tws = twsMin; tws <= twsMax; tws += twsStep) {
+      const [s0, s1, fs] = interp(windSpeeds, tws);
+      const low = sp(sorted[a0], s0) + (sp(sorted[a0], s1) - sp(sorted[a0], s0)) * fs;
+      const high = sp(sorted[a1], s0) + (sp(sorted[a1], s1) - sp(sorted[a1], s0)) * fs;
+      row.push(low + (high - low) * fa);
+    }
+    outRows.push(row);
+  }
+  return polarGridFromRows(outRows, { twaStep, twsMin, twsStep });
+}
+
+function getPolarSpeed(twa, tws) {
+  if (polarGrid) {
+    // O(1) indexed lookup — the grid is dense enough that nearest-bin is
+    // within the accuracy of the underlying table.
+    let folded = Math.abs(twa) % 360;
+    if (folded > 180) folded = 360 - folded;
+    const g = polarGrid;
+    const r = Math.max(0, Math.min(g.rows - 1, Math.round(folded / g.twaStep)));
+    const c = Math.max(0, Math.min(g.cols - 1, Math.round((tws - g.twsMin) / g.twsStep)));
+    return g.values[r * g.cols + c] || 0;
+  }
+  if (!polarData) return 0;
+
+  // Find closest wind speed
+  const windSpeeds = [4, 6, 8, 10, 12, 14, 16, 20, 24];
+  let speedIndex = 0;
+
+  // Find the closest wind speed index
+  for (let i = 0; i < windSpeeds.length; i++) {
+    if (tws <= windSpeeds[i]) {
+      speedIndex = i;
+      break;
+    }
+  }
+
+  // If wind speed is higher than all available speeds, use the last one
+  if (speedIndex === 0 && tws > windSpeeds[0]) {
+    speedIndex = windSpeeds.length - 1;
+  }
+
+  // Find closest TWA, but avoid 0° if possible since it has zero speed
+  let closestAngle = polarData[0];
+  let minDiff = Math.abs(twa - polarData[0].twa);
+
+  for (const angle of polarData) {
+    const diff = Math.abs(twa - angle.twa);
+    if (diff < minDiff) {
+      // Prefer non-zero speeds when possible
+      if (angle.twa === 0 && twa > 10) {
+        // Skip 0° angle if we're not very close to it
+        continue;
+      }
+      minDiff = diff;
+      closestAngle = angle;
+    }
+  }
+
+  return closestAngle.speeds[speedIndex] || 0;
+}
+
+function calculateVMG(bearingToDest, bsp) {
+  // VMG = Boat Speed * cos(angle between boat heading and destination bearing)
+  // This calculates how fast you're progressing toward your destination
+  const angleRad = (bearingToDest * Math.PI) / 180;
+  return bsp * Math.cos(angleRad);
+}
+
+
+function updatePolarPerformance() {
+  if (!polarData) {
+    return;
+  }
+
+  // Check for different wind angle data sources
+  let windAngle = null;
+  if (currentEnv?.wind?.angleTrue?.value) {
+    windAngle = currentEnv.wind.angleTrue.value;
+  } else if (currentEnv?.wind?.angleTrueWater?.value) {
+    windAngle = currentEnv.wind.angleTrueWater.value;
+  } else if (currentEnv?.wind?.angleApparent?.value) {
+    windAngle = currentEnv.wind.angleApparent.value;
+  }
+
+  // Check for different boat speed data sources
+  let boatSpeed = null;
+  if (currentNav?.speedThroughWater?.value) {
+    boatSpeed = currentNav.speedThroughWater.value;
+  } else if (currentNav?.speedOverGround?.value) {
+    boatSpeed = currentNav.speedOverGround.value;
+  }
+
+  // Check for wind speed data
+  let windSpeed = null;
+  if (currentEnv?.wind?.speedTrue?.value) {
+    windSpeed = currentEnv.wind.speedTrue.value;
+  }
+
+  // Use default values if data is missing
+  const twa = windAngle ? windAngle * 180 / Math.PI : 90; // Default to 90 degrees (middle of chart)
+  const bsp = boatSpeed ? boatSpeed * 1.94384 : 0; // Default to 0 knots (center of bullseye)
+  const tws = windSpeed ? windSpeed * 1.94384 : 10; // Default to 10 knots
+
+  const polarSpeed = getPolarSpeed(twa, tws);
+  const performancePercent = polarSpeed > 0 ? (bsp / polarSpeed * 100).toFixed(1) : 0;
+
+  // Engine / propulsion state
+  const engineState = currentPropulsion?.state?.value;
+  const engineHz    = currentPropulsion?.revolutions?.value;
+  const rpm         = engineHz != null ? Math.round(engineHz * 60) : null;
+  const engineOn    = engineState === 'started' || (rpm != null && rpm > 100);
+  const engineColor = engineOn ? '#ef4444' : '#22c55e';
+  const engineLabel = engineOn
+    ? `Running${rpm != null ? ` · ${rpm} RPM` : ''}`
+    : (engineState ? 'Off' : 'N/A');
+
+  // Update performance display
+  const windAngleDisplay = windAngle ? `${twa.toFixed(1)}°` : 'N/A';
+  const boatSpeedDisplay = boatSpeed ? `${bsp.toFixed(1)} kts` : 'N/A';
+  const windSpeedDisplay = windSpeed ? `${tws.toFixed(1)} kts` : 'N/A';
+
+  document.getElementById('polar-performance').innerHTML = `
+    <div><strong>True Wind Angle:</strong> ${windAngleDisplay}</div>
+    <div><strong>True Wind Speed:</strong> ${windSpeedDisplay}</div>
+    <div><strong>Boat Speed:</strong> ${boatSpeedDisplay}</div>
+    <div><strong>Polar Speed:</strong> ${polarSpeed.toFixed(1)} kts</div>
+    <div><strong>Performance:</strong> <span style="color: ${performancePercent >= 95 ? '#27ae60' : performancePercent >= 85 ? '#f39c12' : '#e74c3c'}">${performancePercent}%</span></div>
+    <div><strong>Engine:</strong> <span style="color: ${engineColor}">${engineLabel}</span></div>
+  `;
+
+  // Show/hide motoring badge over the polar chart
+  const indicator = document.getElementById('polar-engine-indicator');
+  if (indicator) {
+    if (engineOn) {
+      indicator.textContent = rpm != null ? `Motoring · ${rpm} RPM` : 'Engine On';
+      indicator.style.display = '';
+    } else {
+      indicator.style.display = 'none';
+    }
+  }
+
+  // Always draw polar chart, even with default values
+  drawPolarChart(twa, bsp, tws);
+}
+
+function drawPolarChart(currentTWA, currentSpeed, currentTWS) {
+  const now = Date.now();
+  if (isDrawingPolarChart) {
+    return;
+  }
+
+
+  if (!polarData) return;
+
+  // Get theme information early for use throughout the function
+  const isDark = isDarkTheme(document.documentElement.getAttribute('data-theme'));
+
+  isDrawingPolarChart = true;
+  lastPolarChartUpdate = now;
+
+  // Create full 360° angle array.
+  // Labels use sailing sign convention: positive = starboard, negative = port.
+  const fullAngles = [];
+  const fullLabels = [];
+
+  // Starboard side: 0° → +180°
+  for (let i = 0; i <= 180; i += 15) {
+    fullAngles.push(i);
+    fullLabels.push(i === 0 ? '0°' : `+${i}°`);
+  }
+
+  // Port side: -165° → -15° (stored internally as 195°→345° for Chart.js)
+  for (let i = 195; i <= 345; i += 15) {
+    fullAngles.push(i);
+    fullLabels.push(`${i - 360}°`);  // 195→-165, 210→-150, … 345→-15
+  }
+
+  const windSpeeds = [4, 6, 8, 10, 12, 14, 16, 20, 24];
+
+  // Find the closest wind speed to current wind speed
+  let closestWindSpeedIndex = 0;
+  let minWindSpeedDiff = Math.abs(currentTWS - windSpeeds[0]);
+  for (let i = 1; i < windSpeeds.length; i++) {
+    const diff = Math.abs(currentTWS - windSpeeds[i]);
+    if (diff < minWindSpeedDiff) {
+      minWindSpeedDiff = diff;
+      closestWindSpeedIndex = i;
+    }
+  }
+
+  // Live marker position: normalize TWA to 0-360 and snap to the chart bins.
+  let normalizedTWA = currentTWA;
+  while (normalizedTWA < 0) normalizedTWA += 360;
+  while (normalizedTWA >= 360) normalizedTWA -= 360;
+  const closestAngleIndex = fullAngles.reduce((closest, angle, index) => {
+    return Math.abs(angle - normalizedTWA) < Math.abs(fullAngles[closest] - normalizedTWA) ? index : closest;
+  }, 0);
+  const currentData = new Array(fullAngles.length).fill(null);
+  currentData[closestAngleIndex] = currentSpeed;
+
+  // Static layers (rings, curves, labels) only change with theme, data, or
+  // the highlighted wind-speed line. While the key holds, Chart.js keeps its
+  // rendered chart and an update tick just moves the live marker dataset —
+  // one cheap repaint instead of a destroy-and-rebuild.
+  const staticKey = `${isDark}|${activePolarSource}|${polarDataVersion}|${closestWindSpeedIndex}`;
+  if (polarChartInstance && polarChartStaticKey === staticKey) {
+    const marker = polarChartInstance.data.datasets[polarChartInstance.data.datasets.length - 1];
+    marker.data = currentData;
+    polarChartInstance.update('none');
+    isDrawingPolarChart = false;
+    return;
+  }
+
+  const canvas = document.getElementById('polarChart');
+  const ctx = canvas.getContext('2d');
+
+  // Ensure previous chart is properly destroyed
+  if (polarChartInstance) {
+    polarChartInstance.destroy();
+    polarChartInstance = null;
+  }
+
+  // Clear the canvas
+  ctx.clearRect(0, 0, canvas.width, canvas.height);
+
+  // Create datasets for each wind speed
+  const polarDatasets = [];
+
+  windSpeeds.forEach((tws, index) => {
+    const speeds = fullAngles.map(angle => {
+      // For angles > 180°, use the mirror angle (360° - angle)
+      const lookupAngle = angle > 180 ? 360 - angle : angle;
+
+      // Find closest angle in polar data
+      let closestAngle = polarData[0];
+      let minDiff = Math.abs(lookupAngle - polarData[0].twa);
+
+      for (const point of polarData) {
+        const diff = Math.abs(lookupAngle - point.twa);
+        if (diff < minDiff) {
+          minDiff = diff;
+          closestAngle = point;
+        }
+      }
+
+      return closestAngle.speeds[index] || 0;
+    });
+
+    const validSpeeds = speeds.filter(speed => speed > 0);
+    if (validSpeeds.length > 0) {
+      // Reverse the color order: red for max wind, blue for min wind
+      const reversedIndex = windSpeeds.length - 1 - index;
+      const hue = reversedIndex * 30; // 0 = red, 30 = orange, 60 = yellow, 120 = green, 180 = cyan, 240 = blue
+
+      // Highlight the closest wind speed line
+      const isClosestWindSpeed = index === closestWindSpeedIndex;
+
+      polarDatasets.push({
+        label: `${tws} kts${isClosestWindSpeed ? ' (Current)' : ''}`,
+        data: speeds,
+        borderColor: isClosestWindSpeed ? (isDark ? '#60a5fa' : '#2563eb') : `hsla(${hue}, 70%, 50%, 0.50)`, // 50% alpha for non-current lines
+        backgroundColor: isClosestWindSpeed ? (isDark ? 'rgba(96,165,250,0.2)' : 'rgba(37,99,235,0.2)') : `hsla(${hue}, 70%, 50%, 0.025)`, // Reduced alpha for background too
+        borderWidth: isClosestWindSpeed ? 4 : 2, // Thicker line for current wind speed
+        fill: false,
+        tension: 0.4,
+        order: isClosestWindSpeed ? 0 : 1 // Current wind speed drawn last (on top)
+      });
+    }
+  });
+
+  // Add current position last so it appears on top
+  polarDatasets.push({
+    label: 'Current',
+    data: currentData,
+    borderColor: isDark ? '#60a5fa' : '#2563eb',
+    backgroundColor: isDark ? '#60a5fa' : '#2563eb',
+    borderWidth: 0, // No line
+    pointRadius: 12,
+    pointHoverRadius: 16,
+    fill: false,
+    tension: 0,
+    showLine: false, // Don't draw lines between points
+    order: -1 // Lower order values are drawn last (on top)
+  });
+
+  // Note: Chart.js radar charts don't support true straight radial lines
+  // The TWA line would need to be implemented as a custom canvas overlay
+  // For now, the current position marker and highlighted wind speed line provide good reference
+
+  let startAngle = 0;
+  let endAngle = 180;
+
+  polarChartInstance = new Chart(ctx, {
+    type: 'radar',
+    data: {
+      labels: fullLabels,
+      datasets: polarDatasets
+    },
+    options: {
+      responsive: true,
+      maintainAspectRatio: false,
+      animation: {
+        duration: 0 // Disable all animations
+      },
+      plugins: {
+        tooltip: {
+          enabled: false
+        },
+        legend: {
+          position: 'top',
+          labels: {
+            usePointStyle: true,
+            color: isDark ? '#ffffff' : '#2c3e50'
+          }
+        }
+      },
+      scales: {
+        r: {
+            beginAtZero: true,
+            grid: {
+              color: isDark ? 'rgba(255, 255, 255, 0.2)' : 'rgba(0, 0, 0, 0.1)'
+            },
+            ticks: {
+              stepSize: 2,
+              color: isDark ? '#ffffff' : '#2c3e50',
+              backdropColor: 'transparent',
+              font: {
+                size: 11,
+                weight: 'bold'
+              }
+            },
+            pointLabels: {
+              color: isDark ? '#ffffff' : '#2c3e50',
+              font: {
+                size: 9,
+              },
+              callback: function(value, index) {
+                return value;
+              }
+            },
+            title: {
+              display: true,
+              text: 'Boat Speed (kts)',
+              color: isDark ? '#ffffff' : '#2c3e50'
+            },
+            startAngle: startAngle,
+            min: 0,
+            max: 12,
+            backgroundColor: 'transparent'
+          }
+        }
+    }
+  });
+
+  polarChartStaticKey = staticKey;
+  isDrawingPolarChart = false;
+}
+
+// Full redraw on theme change — Chart.js point label colors can't be patched
+// in place. Called from updateThemeColors() in app.js when the module is loaded.
+function redrawPolarChartForTheme() {
+  if (!polarData || isDrawingPolarChart) return;
+
+  // Destroy existing chart if it exists
+  if (polarChartInstance) {
+    polarChartInstance.destroy();
+    polarChartInstance = null;
+  }
+
+  // Use the same logic as updatePolarPerformance for consistency
+  let windAngle = null;
+  if (currentEnv?.wind?.angleTrue?.value) {
+    windAngle = currentEnv.wind.angleTrue.value;
+  } else if (currentEnv?.wind?.angleTrueWater?.value) {
+    windAngle = currentEnv.wind.angleTrueWater.value;
+  } else if (currentEnv?.wind?.angleApparent?.value) {
+    windAngle = currentEnv.wind.angleApparent.value;
+  }
+
+  let boatSpeed = null;
+  if (currentNav?.speedThroughWater?.value) {
+    boatSpeed = currentNav.speedThroughWater.value;
+  } else if (currentNav?.speedOverGround?.value) {
+    boatSpeed = currentNav.speedOverGround.value;
+  }
+
+  let windSpeed = null;
+  if (currentEnv?.wind?.speedTrue?.value) {
+    windSpeed = currentEnv.wind.speedTrue.value;
+  }
+
+  // Use default values if data is missing (same as updatePolarPerformance)
+  const twa = windAngle ? windAngle * 180 / Math.PI : 90;
+  const bsp = boatSpeed ? boatSpeed * 1.94384 : 0;
+  const tws = windSpeed ? windSpeed * 1.94384 : 10;
+
+  // Always draw the chart to ensure it appears
+  drawPolarChart(twa, bsp, tws);
+}
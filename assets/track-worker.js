@@ -0,0 +1,118 @@
+// Web Worker: GPX parsing and instrument-log series building off the main
+// thread. app.js posts {id, type, ...} jobs and gets {id, ...result} back with
+// the numeric columns as transferable typed arrays, so a long track no longer
+// freezes the map while it parses. A {type: 'cancel', id} message drops a
+// job's result if it is still pending or in flight.
+
+const cancelled = new Set();
+
+// DOMParser is unavailable in workers, so <trkpt> blocks are extracted with
+// regexes. Our GPX is machine-written by the Pi in one fixed layout (see
+// _build_day_gpx in scripts/update_signalk_data.py), which makes this safe;
+// hand-authored GPX still goes through the DOMParser fallback in app.js.
+const TRKPT_RE = /<trkpt\b([^>]*)>([\s\S]*?)<\/trkpt>/g;
+const LAT_RE = /\blat="([^"]+)"/;
+const LON_RE = /\blon="([^"]+)"/;
+const TIME_RE = /<time>([^<]+)<\/time>/;
+const SPEED_RE = /<(?:\w+:)?speed>([^<]+)<\/(?:\w+:)?speed>/;
+const COURSE_RE = /<(?:\w+:)?course>([^<]+)<\/(?:\w+:)?course>/;
+
+function parseGpx(text) {
+  const lat = [];
+  const lon = [];
+  const ts = [];
+  const sog = [];
+  const cog = [];
+  let m;
+  TRKPT_RE.lastIndex = 0;
+  while ((m = TRKPT_RE.exec(text)) !== null) {
+    const la = parseFloat((LAT_RE.exec(m[1]) || [])[1]);
+    const lo = parseFloat((LON_RE.exec(m[1]) || [])[1]);
+    if (!Number.isFinite(la) || !Number.isFinite(lo)) continue;
+    const body = m[2];
+    const t = TIME_RE.exec(body);
+    const sp = SPEED_RE.exec(body);
+    const co = COURSE_RE.exec(body);
+    lat.push(la);
+    lon.push(lo);
+    ts.push(t ? Date.parse(t[1].trim()) : NaN);
+    sog.push(sp ? parseFloat(sp[1]) : NaN);
+    // Degrees → radians to match the positions_index format.
+    cog.push(co ? parseFloat(co[1]) * Math.PI / 180 : NaN);
+  }
+  return {
+    lat: Float64Array.from(lat),
+    lon: Float64Array.from(lon),
+    ts: Float64Array.from(ts),
+    sog: Float32Array.from(sog),
+    cog: Float32Array.from(cog),
+  };
+}
+
+// Parse instrument-log shard texts and build per-path time/value columns,
+// mirroring buildSeriesFromLog() in app.js.
+function buildSeries(texts, limit) {
+  let entries = [];
+  for (const text of texts) {
+    try {
+      const payload = JSON.parse(text);
+      if (Array.isArray(payload && payload.entries)) entries = entries.concat(payload.entries);
+    } catch (_) { /* corrupt shard — skip it */ }
+  }
+  if (limit > 0) entries = entries.slice(-limit);
+
+  const byPath = new Map();
+  for (const entry of entries) {
+    if (!entry || typeof entry !== 'object') continue;
+    const t = entry.timestamp ? Date.parse(entry.timestamp) : NaN;
+    if (!Number.isFinite(t)) continue;
+    const values = entry.values;
+    if (!values || typeof values !== 'object') continue;
+    for (const path of Object.keys(values)) {
+      const value = values[path];
+      if (typeof value !== 'number' || !Number.isFinite(value)) continue;
+      let lists = byPath.get(path);
+      if (!lists) { lists = { t: [], v: [] }; byPath.set(path, lists); }
+      lists.t.push(t);
+      lists.v.push(value);
+    }
+  }
+
+  const paths = [];
+  const times = [];
+  const values = [];
+  for (const [path, lists] of byPath) {
+    const order = lists.t.map((t, i) => i).sort((a, b) => lists.t[a] - lists.t[b]);
+    paths.push(path);
+    times.push(Float64Array.from(order, (i) => lists.t[i]));
+    values.push(Float32Array.from(order, (i) => lists.v[i]));
+  }
+  return { paths, times, values };
+}
+
+self.onmessage = (event) => {
+  const msg = event.data || {};
+  if (msg.type === 'cancel') {
+    cancelled.add(msg.id);
+    return;
+  }
+  let result;
+  if (msg.type === 'gpx') {
+    result = parseGpx(msg.text);
+  } else if (msg.type === 'series') {
+    result = buildSeries(msg.texts || [], msg.limit || 0);
+  } else {
+    return;
+  }
+  if (cancelled.delete(msg.id)) return; // dropped while parsing
+  const transfers = [];
+  for (const value of Object.values(result)) {
+    if (ArrayBuffer.isView(value)) transfers.push(value.buffer);
+    else if (Array.isArray(value)) {
+      for (const item of value) {
+        if (ArrayBuffer.isView(item)) transfers.push(item.buffer);
+      }
+    }
+  }
+  self.postMessage({ id: msg.id, ...result }, transfers);
+};
@@ -9,11 +9,17 @@ inside the South Beach Harbor privacy zone, and produces:
 Existing GPX files are never overwritten so the script is safe to re-run;
 it only fills in missing days and appends new metadata entries.
 
+A high-water mark (data/telemetry/backfill_state.json) records the last
+snapshot filename processed, so re-runs only parse snapshots newer than the
+previous run instead of rescanning all ~32k files. Pass --full to force a
+full rescan (e.g. after editing privacy zones).
+
 Run from the repo root:
     uv run python -m scripts.backfill_tracks
 """
 from __future__ import annotations
 
+import argparse
 import json
 import math
 import xml.etree.ElementTree as ET
@@ -26,6 +32,7 @@ from .utils import get_project_root, load_vessel_info
 TELEMETRY_DIR = Path("data/telemetry")
 TRACKS_DIR = TELEMETRY_DIR / "tracks"
 TRACKS_INDEX_FILE = TELEMETRY_DIR / "tracks_index.json"
+BACKFILL_STATE_FILE = TELEMETRY_DIR / "backfill_state.json"
 
 # Fallback privacy zone when none are defined in info.yaml.
 _FALLBACK_ZONES: list[tuple[float, float, float]] = [
@@ -168,6 +175,28 @@ def _make_track_meta(date_str: str, points: list[dict[str, Any]]) -> dict[str, A
     }
 
 
+def _load_high_water_mark(path: Path) -> str | None:
+    """Return the last snapshot filename processed by a previous run, if any."""
+    if not path.exists():
+        return None
+    try:
+        data = json.loads(path.read_text())
+        mark = data.get("last_processed") if isinstance(data, dict) else None
+        return mark if isinstance(mark, str) else None
+    except (json.JSONDecodeError, OSError):
+        return None
+
+
+def _save_high_water_mark(path: Path, filename: str) -> None:
+    path.write_text(
+        json.dumps({
+            "last_processed": filename,
+            "updated": datetime.now(UTC).strftime("%Y-%m-%dT%H:%M:%SZ"),
+        }, indent=2),
+        encoding="utf-8",
+    )
+
+
 def _load_tracks_index(path: Path) -> dict[str, dict[str, Any]]:
     if not path.exists():
         return {}
@@ -179,11 +208,20 @@ def _load_tracks_index(path: Path) -> dict[str, dict[str, Any]]:
         return {}
 
 
-def main() -> int:
+def main(argv: list[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description="Backfill per-day GPX tracks from snapshots")
+    parser.add_argument(
+        "--full",
+        action="store_true",
+        help="Ignore the high-water mark and rescan every snapshot file",
+    )
+    args = parser.parse_args(argv or [])
+
     root = get_project_root()
     telemetry_dir = root / TELEMETRY_DIR
     tracks_dir = root / TRACKS_DIR
     tracks_index_path = root / TRACKS_INDEX_FILE
+    state_path = telemetry_dir / BACKFILL_STATE_FILE.name
 
     try:
         vessel_info = load_vessel_info("data/vessel/info.yaml")
@@ -197,12 +235,21 @@ def main() -> int:
     # Collect all timestamped snapshot files (skip index/latest files)
     skip = {"signalk_latest.json", "positions_index.json", "snapshots_index.json",
             "tracks_index.json"}
+    skip.add(BACKFILL_STATE_FILE.name)
     files = sorted(
         f for f in telemetry_dir.glob("*.json")
         if f.name not in skip and not f.name.startswith("tracks")
     )
     print(f"Found {len(files)} snapshot files")
 
+    # Snapshot filenames are UTC timestamps, so lexical order is time order and
+    # a single filename works as the high-water mark.
+    high_water_mark = None if args.full else _load_high_water_mark(state_path)
+    if high_water_mark:
+        before = len(files)
+        files = [f for f in files if f.name > high_water_mark]
+        print(f"Resuming after {high_water_mark} ({before - len(files)} already processed)")
+
     # Parse and group by UTC date
     by_day: dict[str, list[dict[str, Any]]] = {}
     skipped = 0
@@ -243,9 +290,14 @@ def main() -> int:
         json.dumps({"tracks": sorted(existing.values(), key=lambda t: t["date"])}, indent=2),
         encoding="utf-8",
     )
+    if files:
+        _save_high_water_mark(state_path, files[-1].name)
+
     print(f"Done. {written} GPX files written, {len(existing)} total sailing days indexed.")
     return 0
 
 
 if __name__ == "__main__":
-    raise SystemExit(main())
+    import sys
+
+    raise SystemExit(main(sys.argv[1:]))
@@ -0,0 +1,150 @@
+"""Content-hashed production build of the frontend shell into dist/.
+
+The source tree references assets/app.js etc. unversioned, so every deploy
+needs a manual sw.js cache-version bump and returning viewers re-download
+assets that did not change. This build emits copies of the shell assets
+named by content hash (assets/app.<hash>.js), rewrites every reference —
+index.html, the SHELL_ASSETS list and cache name in sw.js, and the lazy
+loader / worker paths inside app.js — injects a preload hint for the first
+position fetch, and writes Brotli .br sidecars for origins that serve them.
+Hashed names never change content, so they can be served with immutable
+long-cache headers; unchanged files keep their hash across deploys and stay
+cached. data/ is symlinked, not copied, since telemetry updates out of band.
+
+Run via `make build`; dist/ is disposable output and is not committed.
+"""
+from __future__ import annotations
+
+import argparse
+import hashlib
+import json
+import re
+import shutil
+from pathlib import Path
+
+from .utils import get_project_root
+
+DIST_DIR = "dist"
+HASH_LEN = 10
+
+# Shell assets hashed and rewritten, in dependency order: leaves first so
+# their hashed names are substituted into app.js before app.js is hashed.
+HASHED_ASSETS = [
+    "assets/styles.css",
+    "assets/constants.js",
+    "assets/utils.js",
+    "assets/track-worker.js",
+    "assets/polar.js",
+    "assets/app.js",
+]
+
+# First telemetry fetch the page makes — preloading it overlaps the JSON
+# download with script parse instead of serializing behind it.
+FIRST_FETCH_PRELOAD = (
+    '  <link rel="preload" href="data/telemetry/signalk_latest.json" as="fetch" crossorigin="anonymous" />\n'
+)
+
+
+def _hash_name(path: str, data: bytes) -> str:
+    digest = hashlib.sha256(data).hexdigest()[:HASH_LEN]
+    p = Path(path)
+    return str(p.with_name(f"{p.stem}.{digest}{p.suffix}"))
+
+
+def _substitute(text: str, mapping: dict[str, str]) -> str:
+    """Rewrite asset references, swallowing any ?v=N cache-buster query."""
+    for original, hashed in mapping.items():
+        text = re.sub(rf"{re.escape(original)}(\?v=\d+)?", hashed, text)
+    return text
+
+
+def _write_brotli(path: Path) -> bool:
+    try:
+        import brotli
+    except ImportError:
+        return False
+    path.with_suffix(path.suffix + ".br").write_bytes(
+        brotli.compress(path.read_bytes(), quality=11)
+    )
+    return True
+
+
+def build(project_root: Path, dist_dir: Path) -> dict[str, str]:
+    """Build dist/ and return the original → hashed asset name mapping."""
+    if dist_dir.exists():
+        shutil.rmtree(dist_dir)
+    (dist_dir / "assets").mkdir(parents=True)
+
+    mapping: dict[str, str] = {}
+    for rel in HASHED_ASSETS:
+        data = _substitute(
+            (project_root / rel).read_text(encoding="utf-8"), mapping
+        ).encode("utf-8")
+        hashed = _hash_name(rel, data)
+        (dist_dir / hashed).write_bytes(data)
+        mapping[rel] = hashed
+
+    # Non-hashed asset files (icons, webmanifest) copy through unchanged.
+    for asset in sorted((project_root / "assets").iterdir()):
+        if asset.is_file() and f"assets/{asset.name}" not in mapping:
+            shutil.copy2(asset, dist_dir / "assets" / asset.name)
+
+    html = _substitute((project_root / "index.html").read_text(encoding="utf-8"), mapping)
+    if "signalk_latest.json" not in html.split("</head>")[0]:
+        html = html.replace("</head>", f"{FIRST_FETCH_PRELOAD}</head>", 1)
+    (dist_dir / "index.html").write_text(html, encoding="utf-8")
+
+    sw = _substitute((project_root / "sw.js").read_text(encoding="utf-8"), mapping)
+    # The cache version follows the bundle content, so deploys invalidate
+    # exactly when something shipped actually changed.
+    bundle_hash = hashlib.sha256(
+        "".join(mapping.values()).encode("utf-8")
+    ).hexdigest()[:HASH_LEN]
+    sw = re.sub(
+        r"const SHELL_CACHE\s*=\s*'[^']*'",
+        f"const SHELL_CACHE   = 'mermug-shell-{bundle_hash}'",
+        sw,
+    )
+    (dist_dir / "sw.js").write_text(sw, encoding="utf-8")
+
+    shutil.copy2(project_root / "manifest.json", dist_dir / "manifest.json")
+
+    # Telemetry updates out of band on the Pi — link it rather than copying
+    # the tens of thousands of committed snapshot files.
+    (dist_dir / "data").symlink_to(project_root / "data", target_is_directory=True)
+
+    compressed = sum(
+        _write_brotli(dist_dir / hashed) for hashed in mapping.values()
+    ) + sum(
+        _write_brotli(dist_dir / name) for name in ("index.html", "sw.js")
+    )
+    if compressed == 0:
+        print("Note: brotli module not installed — skipping .br sidecars")
+
+    return mapping
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(
+        description="Build the content-hashed frontend shell into dist/"
+    )
+    parser.add_argument(
+        "--dist-dir", default=DIST_DIR, help=f"Output directory (default: {DIST_DIR})"
+    )
+    return parser.parse_args()
+
+
+def main() -> int:
+    args = parse_args()
+    project_root = get_project_root()
+    dist_dir = Path(args.dist_dir)
+    if not dist_dir.is_absolute():
+        dist_dir = project_root / dist_dir
+    mapping = build(project_root, dist_dir)
+    print(json.dumps(mapping, indent=2))
+    print(f"Built {len(mapping)} hashed assets into {dist_dir}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,120 @@
+"""Build the grid-bucket nearest-station index inside data/tide_stations.json.
+
+The frontend used to linearly scan every station computing a haversine
+distance per candidate on each refresh tick. This script buckets stations
+into fixed-size lat/lon grid cells and embeds the index alongside the
+station list (same file, one fetch), so findNearestNOAAStation() in
+assets/app.js probes only the cell containing the position plus expanding
+neighbor rings — constant work however many stations the file grows to.
+
+Run it whenever stations are added:
+    uv run python -m scripts.build_tide_station_index
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import math
+from pathlib import Path
+from typing import Any
+
+from .utils import get_project_root
+
+TIDE_STATIONS_FILE = "data/tide_stations.json"
+# 1° ≈ 111 km of latitude — coarse enough that a coastal hop stays within a
+# ring or two of cells, fine enough that buckets hold a handful of stations.
+GRID_CELL_DEG = 1.0
+
+
+def grid_key(lat: float, lon: float, cell_deg: float = GRID_CELL_DEG) -> str:
+    """Cell key for a position; must match stationGridKey() in assets/app.js."""
+    return f"{math.floor(lat / cell_deg)}:{math.floor(lon / cell_deg)}"
+
+
+def build_grid(
+    stations: list[dict[str, Any]], cell_deg: float = GRID_CELL_DEG
+) -> dict[str, Any]:
+    """Bucket station list indexes by grid cell.
+
+    Buckets hold indexes into the stations array (not copies), so the index
+    adds only a few bytes per station to the file.
+    """
+    cells: dict[str, list[int]] = {}
+    for i, station in enumerate(stations):
+        lat, lon = station.get("lat"), station.get("lon")
+        if not isinstance(lat, (int, float)) or not isinstance(lon, (int, float)):
+            continue
+        cells.setdefault(grid_key(lat, lon, cell_deg), []).append(i)
+    return {"cell_deg": cell_deg, "cells": cells}
+
+
+def _render_stations_file(
+    text: str, stations: list[dict[str, Any]], grid: dict[str, Any]
+) -> str:
+    """Re-emit the file with station lines untouched and the grid on one line.
+
+    The file is shell-precached and hand-kept as one station per line, so a
+    rebuild must not reformat it: keep the existing station lines verbatim and
+    serialize the grid compactly, so the diff is just the grid object and the
+    payload does not balloon with indentation.
+    """
+    grid_line = f'  "grid": {json.dumps(grid, separators=(",", ":"))}'
+    lines = text.splitlines()
+    try:
+        start = next(i for i, line in enumerate(lines) if '"stations"' in line)
+        end = next(
+            i for i in range(start + 1, len(lines)) if lines[i].strip() in ("]", "],")
+        )
+        station_lines = lines[start + 1 : end]
+    except StopIteration:
+        # Unrecognized layout — normalize to one compact station per line.
+        station_lines = [
+            "      " + json.dumps(s, separators=(", ", ": "))
+            + ("," if i < len(stations) - 1 else "")
+            for i, s in enumerate(stations)
+        ]
+    return "\n".join(["{", '  "stations": [', *station_lines, "  ],", grid_line, "}", ""])
+
+
+def rebuild_index(stations_path: Path, cell_deg: float = GRID_CELL_DEG) -> int:
+    """Rewrite the stations file with a fresh grid index; returns cell count."""
+    text = stations_path.read_text(encoding="utf-8")
+    data = json.loads(text)
+    stations = data.get("stations", []) if isinstance(data, dict) else []
+    if not isinstance(stations, list):
+        raise ValueError(f"{stations_path} has no stations list")
+    grid = build_grid(stations, cell_deg)
+    stations_path.write_text(_render_stations_file(text, stations, grid), encoding="utf-8")
+    return len(grid["cells"])
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(
+        description="Rebuild the grid-bucket station index in data/tide_stations.json"
+    )
+    parser.add_argument(
+        "--cell-deg",
+        type=float,
+        default=GRID_CELL_DEG,
+        help=f"Grid cell size in degrees (default: {GRID_CELL_DEG})",
+    )
+    return parser.parse_args()
+
+
+def main() -> int:
+    args = parse_args()
+    stations_path = get_project_root() / TIDE_STATIONS_FILE
+    if not stations_path.exists():
+        print(f"Error: {stations_path} not found")
+        return 1
+    try:
+        cell_count = rebuild_index(stations_path, args.cell_deg)
+    except (json.JSONDecodeError, ValueError) as exc:
+        print(f"Error: could not rebuild station index: {exc}")
+        return 1
+    print(f"Wrote grid index ({cell_count} cells) to {stations_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,127 @@
+"""Squash old telemetry history so clones stay small.
+
+git_commit_and_push() adds one commit per update cycle, so the branch the Pi
+pushes to grows without bound — fresh clones for the shore mirror pull
+hundreds of MB of retired snapshots. The updater already supports a dedicated
+data branch via --branch / GIT_BRANCH (point GitHub Pages at it, or keep
+development on another branch); this script is the companion compaction job:
+it collapses every commit older than --days into a single baseline commit
+holding the same tree, replays the retained history on top, and force-pushes
+with a lease. Snapshot files retired by _prune_old_position_files() then
+leave the reachable history entirely, so clone size stays roughly constant
+over the vessel's lifetime.
+
+Run it occasionally by hand (make compact-history) or from cron — it refuses
+to touch a dirty working tree and aborts cleanly if the replay conflicts.
+"""
+from __future__ import annotations
+
+import argparse
+import os
+import subprocess
+import sys
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+
+COMPACT_DEFAULT_DAYS = 90
+
+
+def _git(args: list[str], cwd: Path | None = None) -> str:
+    result = subprocess.run(
+        ["git", *args], cwd=cwd, capture_output=True, text=True, check=True,
+    )
+    return result.stdout.strip()
+
+
+def working_tree_is_clean(cwd: Path | None = None) -> bool:
+    return _git(["status", "--porcelain"], cwd=cwd) == ""
+
+
+def find_oldest_retained_commit(branch: str, cutoff: datetime, cwd: Path | None = None) -> str | None:
+    """Return the oldest commit on `branch` newer than `cutoff`, or None."""
+    out = _git(
+        ["rev-list", "--reverse", f"--since={cutoff.isoformat()}", branch],
+        cwd=cwd,
+    )
+    return out.splitlines()[0] if out else None
+
+
+def squash_history_before(boundary: str, branch: str, cwd: Path | None = None) -> bool:
+    """Collapse all commits before `boundary` into one baseline commit.
+
+    The baseline holds the exact tree of the last squashed commit, so file
+    contents are unchanged — only the history behind the retention window is
+    rewritten. Returns True when the branch was rewritten.
+    """
+    try:
+        base = _git(["rev-parse", f"{boundary}^"], cwd=cwd)
+    except subprocess.CalledProcessError:
+        return False  # boundary is the root commit — nothing behind it
+    squashed = int(_git(["rev-list", "--count", base], cwd=cwd))
+    if squashed <= 1:
+        return False
+
+    base_date = _git(["log", "-1", "--format=%cs", base], cwd=cwd)
+    baseline = _git([
+        "commit-tree", f"{base}^{{tree}}",
+        "-m", f"Telemetry baseline through {base_date} ({squashed} commits squashed)",
+    ], cwd=cwd)
+    try:
+        _git(["rebase", "--onto", baseline, base, branch], cwd=cwd)
+    except subprocess.CalledProcessError as e:
+        subprocess.run(["git", "rebase", "--abort"], cwd=cwd, check=False)
+        print(f"Compaction aborted, branch left untouched: {e.stderr or e}")
+        return False
+    return True
+
+
+def parse_args(argv: list[str] | None = None) -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="Squash telemetry history older than N days")
+    parser.add_argument("--days", type=int, default=COMPACT_DEFAULT_DAYS,
+                        help="keep full history this many days back")
+    parser.add_argument("--branch", default=os.getenv("GIT_BRANCH", "main"))
+    parser.add_argument("--remote", default=os.getenv("GIT_REMOTE", "origin"))
+    parser.add_argument("--no-push", action="store_true",
+                        help="rewrite locally but skip the force push")
+    parser.add_argument("--dry-run", action="store_true",
+                        help="report what would be squashed without rewriting")
+    return parser.parse_args(argv if argv is not None else sys.argv[1:])
+
+
+def main(argv: list[str] | None = None) -> int:
+    args = parse_args(argv)
+    if not working_tree_is_clean():
+        print("Working tree is dirty - commit or stash before compacting history")
+        return 1
+
+    cutoff = datetime.now(UTC) - timedelta(days=args.days)
+    boundary = find_oldest_retained_commit(args.branch, cutoff)
+    if boundary is None:
+        print(f"No commits newer than {args.days} days on {args.branch} - nothing to compact")
+        return 0
+
+    if args.dry_run:
+        try:
+            base_count = int(_git(["rev-list", "--count", f"{boundary}^"]))
+        except subprocess.CalledProcessError:
+            base_count = 0
+        print(f"Would squash {base_count} commits older than {cutoff:%Y-%m-%d} on {args.branch}")
+        return 0
+
+    if not squash_history_before(boundary, args.branch):
+        print("History already compact")
+        return 0
+
+    print(f"Squashed history older than {cutoff:%Y-%m-%d} on {args.branch}")
+    if not args.no_push:
+        # Lease protects against clobbering commits pushed from elsewhere
+        # since our last fetch (e.g. the updater service mid-cycle).
+        subprocess.run(
+            ["git", "push", "--force-with-lease", args.remote, args.branch],
+            check=True,
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
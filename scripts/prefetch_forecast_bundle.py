@@ -0,0 +1,164 @@
+"""Prefetch the Open-Meteo conditions forecast for the vessel's position.
+
+loadConditionsForecast() used to hit the Open-Meteo atmospheric and marine
+APIs from every viewer's browser — duplicate fetches that offshore viewers
+pay for over the boat's own hotspot, and the panel rendered seconds after
+the rest of the page. This module fetches both forecasts once on the Pi and
+writes data/telemetry/forecast_bundle.json next to the position cache; the
+update service commits it and every viewer reads the same file from the
+site origin. The raw API payloads are stored unmodified so the frontend
+reuses its existing parsing, falling back to live Open-Meteo only when the
+bundle is stale or for somewhere far from the viewer's forecast position.
+
+Invoked automatically from the update loop (refresh_bundle_if_stale) or by
+hand:
+    uv run python -m scripts.prefetch_forecast_bundle
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import math
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+from typing import Any
+
+import requests
+
+from .utils import get_project_root
+
+FORECAST_BUNDLE_FILE = "data/telemetry/forecast_bundle.json"
+
+ATMOS_API_URL = "https://api.open-meteo.com/v1/forecast"
+MARINE_API_URL = "https://marine-api.open-meteo.com/v1/marine"
+
+# Must match the hourly variables loadConditionsForecast() charts.
+ATMOS_HOURLY = ("wind_speed_10m,wind_gusts_10m,wind_direction_10m,temperature_2m,"
+                "surface_pressure,precipitation_probability,cloud_cover")
+MARINE_HOURLY = "wave_height,wave_period,wave_direction,ocean_current_velocity,ocean_current_direction"
+
+BUNDLE_REFRESH_HOURS = 1
+# A forecast fetched for an anchorage 25 km away is a different forecast.
+BUNDLE_MAX_DISTANCE_M = 25_000.0
+
+# Default position when no GPS fix is available (matches frontend fallback).
+DEFAULT_LAT = 37.806
+DEFAULT_LON = -122.465
+
+
+def _haversine_m(lat1: float, lon1: float, lat2: float, lon2: float) -> float:
+    R = 6_371_000.0
+    phi1, phi2 = math.radians(lat1), math.radians(lat2)
+    dphi = math.radians(lat2 - lat1)
+    dlam = math.radians(lon2 - lon1)
+    a = math.sin(dphi / 2) ** 2 + math.cos(phi1) * math.cos(phi2) * math.sin(dlam / 2) ** 2
+    return R * 2 * math.asin(math.sqrt(a))
+
+
+def _fetch(url: str, params: dict[str, Any]) -> dict[str, Any]:
+    response = requests.get(url, params=params, timeout=30)
+    response.raise_for_status()
+    payload = response.json()
+    if not isinstance(payload, dict) or "hourly" not in payload:
+        raise RuntimeError(f"Unexpected Open-Meteo payload from {url}")
+    return payload
+
+
+def build_bundle(lat: float, lon: float) -> dict[str, Any]:
+    """Fetch atmospheric + marine forecasts; either may fail independently.
+
+    The date window spans yesterday through three days out (local to the
+    vessel via timezone=auto), comfortably covering the frontend's 48-hour
+    chart window for viewers in any timezone.
+    """
+    now = datetime.now(UTC)
+    start = (now - timedelta(days=1)).strftime("%Y-%m-%d")
+    end = (now + timedelta(days=3)).strftime("%Y-%m-%d")
+    common = {
+        "latitude": f"{lat:.4f}",
+        "longitude": f"{lon:.4f}",
+        "timezone": "auto",
+        "start_date": start,
+        "end_date": end,
+    }
+
+    bundle: dict[str, Any] = {
+        "generated": now.isoformat(),
+        "latitude": round(lat, 4),
+        "longitude": round(lon, 4),
+    }
+    try:
+        bundle["atmos"] = _fetch(ATMOS_API_URL, {
+            **common,
+            "hourly": ATMOS_HOURLY,
+            "wind_speed_unit": "kn",
+            "temperature_unit": "fahrenheit",
+        })
+    except (requests.RequestException, RuntimeError, ValueError) as exc:
+        print(f"Forecast prefetch: atmospheric fetch failed: {exc}")
+    try:
+        bundle["marine"] = _fetch(MARINE_API_URL, {**common, "hourly": MARINE_HOURLY})
+    except (requests.RequestException, RuntimeError, ValueError) as exc:
+        print(f"Forecast prefetch: marine fetch failed: {exc}")
+    return bundle
+
+
+def bundle_is_fresh(path: Path, lat: float, lon: float,
+                    max_age_hours: float = BUNDLE_REFRESH_HOURS) -> bool:
+    """Fresh = recent enough AND fetched for roughly the current position."""
+    if not path.exists():
+        return False
+    try:
+        bundle = json.loads(path.read_text(encoding="utf-8"))
+        generated_dt = datetime.fromisoformat(bundle.get("generated"))
+        bundle_lat = float(bundle["latitude"])
+        bundle_lon = float(bundle["longitude"])
+    except (json.JSONDecodeError, OSError, TypeError, ValueError, KeyError):
+        return False
+    if datetime.now(UTC) - generated_dt >= timedelta(hours=max_age_hours):
+        return False
+    return _haversine_m(lat, lon, bundle_lat, bundle_lon) <= BUNDLE_MAX_DISTANCE_M
+
+
+def refresh_bundle_if_stale(project_root: Path, lat: float | None, lon: float | None) -> Path | None:
+    """Rebuild the committed bundle when it is old or the vessel has moved.
+
+    Returns the bundle path when (re)written, None when still fresh or when
+    both API fetches failed (the old bundle is kept in that case).
+    """
+    lat = lat if lat is not None else DEFAULT_LAT
+    lon = lon if lon is not None else DEFAULT_LON
+    bundle_path = project_root / FORECAST_BUNDLE_FILE
+    if bundle_is_fresh(bundle_path, lat, lon):
+        return None
+    bundle = build_bundle(lat, lon)
+    if "atmos" not in bundle and "marine" not in bundle:
+        print("Forecast prefetch: both fetches failed — keeping previous bundle")
+        return None
+    bundle_path.parent.mkdir(parents=True, exist_ok=True)
+    bundle_path.write_text(json.dumps(bundle, separators=(",", ":")), encoding="utf-8")
+    print(f"Forecast prefetch: wrote {bundle_path.name} for ({lat:.3f}, {lon:.3f})")
+    return bundle_path
+
+
+def main(argv: list[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description="Prefetch the Open-Meteo conditions forecast")
+    parser.add_argument("--lat", type=float, default=DEFAULT_LAT)
+    parser.add_argument("--lon", type=float, default=DEFAULT_LON)
+    args = parser.parse_args(argv or [])
+
+    bundle = build_bundle(args.lat, args.lon)
+    if "atmos" not in bundle and "marine" not in bundle:
+        print("No forecast fetched.")
+        return 1
+    bundle_path = get_project_root() / FORECAST_BUNDLE_FILE
+    bundle_path.parent.mkdir(parents=True, exist_ok=True)
+    bundle_path.write_text(json.dumps(bundle, separators=(",", ":")), encoding="utf-8")
+    print(f"Wrote {bundle_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    import sys
+
+    raise SystemExit(main(sys.argv[1:]))
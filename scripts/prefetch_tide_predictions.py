@@ -0,0 +1,195 @@
+"""Prefetch NOAA tide prediction bundles for the stations nearest the vessel.
+
+Tide predictions are deterministic, so there is no reason for every viewer's
+browser to hit the NOAA API on page load. This module fetches 7-day hourly
+MLLW predictions for the nearest few stations from data/tide_stations.json
+and writes them to data/telemetry/tide_predictions.json, which the update
+service commits alongside the telemetry. The frontend reads the committed
+bundle and only falls back to live NOAA when the bundle has gone stale.
+
+Invoked automatically from the update loop (refresh_bundle_if_stale) or by
+hand:
+    uv run python -m scripts.prefetch_tide_predictions
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import math
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+from typing import Any
+
+import requests
+
+from .utils import get_project_root
+
+TIDE_STATIONS_FILE = "data/tide_stations.json"
+TIDE_BUNDLE_FILE = "data/telemetry/tide_predictions.json"
+
+NOAA_API_URL = "https://api.tidesandcurrents.noaa.gov/api/prod/datagetter"
+BUNDLE_DAYS = 7
+BUNDLE_STATION_COUNT = 3
+BUNDLE_REFRESH_HOURS = 6
+SF_FALLBACK_STATION_ID = "9414290"  # always bundled — the frontend's fallback
+
+# Default position when no GPS fix is available (matches frontend fallback).
+DEFAULT_LAT = 37.806
+DEFAULT_LON = -122.465
+
+
+def _haversine_m(lat1: float, lon1: float, lat2: float, lon2: float) -> float:
+    R = 6_371_000.0
+    phi1, phi2 = math.radians(lat1), math.radians(lat2)
+    dphi = math.radians(lat2 - lat1)
+    dlam = math.radians(lon2 - lon1)
+    a = math.sin(dphi / 2) ** 2 + math.cos(phi1) * math.cos(phi2) * math.sin(dlam / 2) ** 2
+    return R * 2 * math.asin(math.sqrt(a))
+
+
+def _load_stations(path: Path) -> list[dict[str, Any]]:
+    try:
+        data = json.loads(path.read_text(encoding="utf-8"))
+        stations = data.get("stations", []) if isinstance(data, dict) else []
+        return [s for s in stations if isinstance(s, dict) and "id" in s]
+    except (json.JSONDecodeError, OSError):
+        return []
+
+
+def nearest_stations(
+    stations: list[dict[str, Any]],
+    lat: float,
+    lon: float,
+    count: int = BUNDLE_STATION_COUNT,
+) -> list[dict[str, Any]]:
+    """The *count* stations closest to (lat, lon), plus the SF fallback."""
+    ranked = sorted(
+        (s for s in stations if isinstance(s.get("lat"), (int, float))
+         and isinstance(s.get("lon"), (int, float))),
+        key=lambda s: _haversine_m(lat, lon, s["lat"], s["lon"]),
+    )
+    selected = ranked[:count]
+    if not any(s["id"] == SF_FALLBACK_STATION_ID for s in selected):
+        fallback = next((s for s in stations if s.get("id") == SF_FALLBACK_STATION_ID), None)
+        if fallback is not None:
+            selected.append(fallback)
+    return selected
+
+
+def fetch_station_predictions(station_id: str, begin: str, end: str) -> list[dict[str, str]]:
+    """Fetch hourly MLLW predictions for one station; raises on API errors."""
+    response = requests.get(NOAA_API_URL, params={
+        "product": "predictions",
+        "application": "vessel-tracker",
+        "begin_date": begin,
+        "end_date": end,
+        "datum": "MLLW",
+        "station": station_id,
+        "time_zone": "gmt",
+        "units": "english",
+        "interval": "h",
+        "format": "json",
+    }, timeout=30)
+    response.raise_for_status()
+    payload = response.json()
+    if isinstance(payload, dict) and payload.get("error"):
+        raise RuntimeError(payload["error"].get("message", "NOAA API error"))
+    predictions = payload.get("predictions", []) if isinstance(payload, dict) else []
+    return predictions if isinstance(predictions, list) else []
+
+
+def bundle_is_fresh(path: Path, max_age_hours: float = BUNDLE_REFRESH_HOURS) -> bool:
+    if not path.exists():
+        return False
+    try:
+        generated = json.loads(path.read_text(encoding="utf-8")).get("generated")
+        generated_dt = datetime.fromisoformat(generated)
+    except (json.JSONDecodeError, OSError, TypeError, ValueError, AttributeError):
+        return False
+    return datetime.now(UTC) - generated_dt < timedelta(hours=max_age_hours)
+
+
+def build_bundle(lat: float, lon: float, *, stations_path: Path,
+                 days: int = BUNDLE_DAYS,
+                 count: int = BUNDLE_STATION_COUNT) -> dict[str, Any]:
+    """Fetch predictions for the nearest stations; failed stations are skipped."""
+    now = datetime.now(UTC)
+    # Start a day back: the conditions panel charts 24 h of history too.
+    begin = (now - timedelta(days=1)).strftime("%Y%m%d")
+    end = (now + timedelta(days=days)).strftime("%Y%m%d")
+
+    bundled: list[dict[str, Any]] = []
+    for station in nearest_stations(_load_stations(stations_path), lat, lon, count):
+        try:
+            predictions = fetch_station_predictions(str(station["id"]), begin, end)
+        except (requests.RequestException, RuntimeError, ValueError) as exc:
+            print(f"Tide prefetch: station {station.get('id')} failed: {exc}")
+            continue
+        if not predictions:
+            continue
+        bundled.append({
+            "id": str(station["id"]),
+            "name": station.get("name"),
+            "lat": station.get("lat"),
+            "lon": station.get("lon"),
+            "predictions": predictions,
+        })
+
+    return {
+        "generated": now.isoformat(),
+        "begin": begin,
+        "end": end,
+        "days": days,
+        "stations": bundled,
+    }
+
+
+def refresh_bundle_if_stale(project_root: Path, lat: float | None, lon: float | None) -> Path | None:
+    """Rebuild the committed bundle when it is older than BUNDLE_REFRESH_HOURS.
+
+    Returns the bundle path when (re)written, None when still fresh or when
+    every station fetch failed (the old bundle is kept in that case).
+    """
+    bundle_path = project_root / TIDE_BUNDLE_FILE
+    if bundle_is_fresh(bundle_path):
+        return None
+    bundle = build_bundle(
+        lat if lat is not None else DEFAULT_LAT,
+        lon if lon is not None else DEFAULT_LON,
+        stations_path=project_root / TIDE_STATIONS_FILE,
+    )
+    if not bundle["stations"]:
+        print("Tide prefetch: no stations fetched — keeping previous bundle")
+        return None
+    bundle_path.parent.mkdir(parents=True, exist_ok=True)
+    bundle_path.write_text(json.dumps(bundle, separators=(",", ":")), encoding="utf-8")
+    print(f"Tide prefetch: wrote {len(bundle['stations'])} stations to {bundle_path.name}")
+    return bundle_path
+
+
+def main(argv: list[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description="Prefetch NOAA tide prediction bundles")
+    parser.add_argument("--days", type=int, default=BUNDLE_DAYS)
+    parser.add_argument("--count", type=int, default=BUNDLE_STATION_COUNT,
+                        help="Number of nearby stations to bundle")
+    parser.add_argument("--lat", type=float, default=DEFAULT_LAT)
+    parser.add_argument("--lon", type=float, default=DEFAULT_LON)
+    args = parser.parse_args(argv or [])
+
+    root = get_project_root()
+    bundle = build_bundle(args.lat, args.lon, stations_path=root / TIDE_STATIONS_FILE,
+                          days=args.days, count=args.count)
+    if not bundle["stations"]:
+        print("No tide predictions fetched.")
+        return 1
+    bundle_path = root / TIDE_BUNDLE_FILE
+    bundle_path.parent.mkdir(parents=True, exist_ok=True)
+    bundle_path.write_text(json.dumps(bundle, separators=(",", ":")), encoding="utf-8")
+    print(f"Wrote {bundle_path} ({len(bundle['stations'])} stations, {args.days} days)")
+    return 0
+
+
+if __name__ == "__main__":
+    import sys
+
+    raise SystemExit(main(sys.argv[1:]))
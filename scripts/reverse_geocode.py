@@ -0,0 +1,104 @@
+"""Resolve a human-readable location name on the Pi and commit it.
+
+Every viewer's browser used to reverse-geocode the vessel position against
+OpenStreetMap Nominatim — the same coordinates, the same answer, ~800 ms on
+the first paint, and rate limits during traffic spikes. The update loop now
+resolves the name once here and commits it as data/telemetry/location.json;
+the frontend reads that file and only falls back to Nominatim when the
+committed name is missing or too far from the current position.
+
+Lookups are cached in data/telemetry/geocode_cache.json keyed by rounded
+coordinates, so returning to a known anchorage costs no API call at all.
+"""
+from __future__ import annotations
+
+import json
+from datetime import UTC, datetime
+from pathlib import Path
+
+import requests
+
+NOMINATIM_URL = "https://nominatim.openstreetmap.org/reverse"
+GEOCODE_CACHE_FILE = "data/telemetry/geocode_cache.json"
+LOCATION_FILE = "data/telemetry/location.json"
+
+# ~1 km grid: one Nominatim answer covers a whole anchorage at zoom 10.
+CACHE_COORD_DECIMALS = 2
+
+# Nominatim usage policy requires an identifying User-Agent.
+_REQUEST_HEADERS = {"User-Agent": "vessel-tracker (github.com/zackphillips)"}
+
+
+def _cache_key(lat: float, lon: float) -> str:
+    return f"{round(lat, CACHE_COORD_DECIMALS)},{round(lon, CACHE_COORD_DECIMALS)}"
+
+
+def _load_cache(path: Path) -> dict[str, str]:
+    try:
+        cache = json.loads(path.read_text(encoding="utf-8"))
+        return cache if isinstance(cache, dict) else {}
+    except (json.JSONDecodeError, OSError):
+        return {}
+
+
+def _shorten_display_name(display_name: str) -> str:
+    """Match the frontend's "city, state" shortening of Nominatim names."""
+    parts = display_name.split(", ")
+    if len(parts) >= 2:
+        return f"{parts[0]}, {parts[1]}"
+    return display_name
+
+
+def resolve_location_name(lat: float, lon: float, cache_path: Path) -> str | None:
+    """Resolve (lat, lon) to a short place name, using the on-disk cache."""
+    cache = _load_cache(cache_path)
+    key = _cache_key(lat, lon)
+    if key in cache:
+        return cache[key]
+
+    response = requests.get(NOMINATIM_URL, params={
+        "lat": f"{lat:.6f}",
+        "lon": f"{lon:.6f}",
+        "format": "json",
+        "zoom": 10,
+        "addressdetails": 1,
+    }, headers=_REQUEST_HEADERS, timeout=10)
+    response.raise_for_status()
+    display_name = response.json().get("display_name")
+    if not isinstance(display_name, str) or not display_name:
+        return None
+
+    name = _shorten_display_name(display_name)
+    cache[key] = name
+    cache_path.parent.mkdir(parents=True, exist_ok=True)
+    cache_path.write_text(json.dumps(cache, indent=2, sort_keys=True), encoding="utf-8")
+    return name
+
+
+def update_location_file(project_root: Path, lat: float, lon: float) -> Path | None:
+    """Write data/telemetry/location.json for the (display) position.
+
+    Returns the written path, or None when the name could not be resolved —
+    the previous location file is left in place in that case.
+    """
+    location_path = project_root / LOCATION_FILE
+    try:
+        existing = json.loads(location_path.read_text(encoding="utf-8"))
+    except (json.JSONDecodeError, OSError):
+        existing = {}
+    # Same grid as the cache: skip the write entirely when nothing changed.
+    if isinstance(existing, dict) and existing.get("key") == _cache_key(lat, lon):
+        return None
+
+    name = resolve_location_name(lat, lon, project_root / GEOCODE_CACHE_FILE)
+    if name is None:
+        return None
+    location_path.parent.mkdir(parents=True, exist_ok=True)
+    location_path.write_text(json.dumps({
+        "name": name,
+        "latitude": round(lat, 6),
+        "longitude": round(lon, 6),
+        "key": _cache_key(lat, lon),
+        "updated": datetime.now(UTC).isoformat(),
+    }, separators=(",", ":")), encoding="utf-8")
+    return location_path
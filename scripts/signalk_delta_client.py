@@ -0,0 +1,162 @@
+"""SignalK WebSocket delta-stream client for the update daemon.
+
+Instead of GETting the entire SignalK tree every interval (which makes the
+server serialize everything and the Pi re-parse it just to throw most of it
+away), this client subscribes to the delta stream for only the top-level
+branches we publish and folds the updates into an in-memory tree shaped like
+the REST blob. The update loop then snapshots that tree on its normal cadence
+with zero extra SignalK traffic, and sub-interval events (gusts, course
+changes) land in the state instead of being missed between polls.
+
+The connection runs in a daemon thread and reconnects with backoff, so a
+SignalK restart just causes a brief gap rather than killing the service.
+"""
+from __future__ import annotations
+
+import copy
+import json
+import threading
+import time
+from typing import Any
+from urllib.parse import urlsplit
+
+import websocket
+
+RECONNECT_MIN_S = 1.0
+RECONNECT_MAX_S = 60.0
+
+
+def stream_url_from_api_url(api_url: str) -> str:
+    """Derive the delta-stream URL from a REST API URL.
+
+    http://host:3000/signalk/v1/api/vessels/self
+      -> ws://host:3000/signalk/v1/stream?subscribe=none
+    """
+    parts = urlsplit(api_url)
+    scheme = "wss" if parts.scheme == "https" else "ws"
+    return f"{scheme}://{parts.netloc}/signalk/v1/stream?subscribe=none"
+
+
+class SignalKDeltaClient:
+    """Maintains a REST-blob-shaped state tree from SignalK delta messages."""
+
+    def __init__(self, api_url: str, top_level_keys: frozenset[str]):
+        self._stream_url = stream_url_from_api_url(api_url)
+        self._top_level_keys = top_level_keys
+        self._lock = threading.Lock()
+        self._state: dict[str, Any] = {}
+        self._stop = threading.Event()
+        self._thread: threading.Thread | None = None
+        self._connected = threading.Event()
+
+    # ── Public API ──────────────────────────────────────────────────────────
+
+    def start(self) -> None:
+        self._thread = threading.Thread(target=self._run, daemon=True,
+                                        name="signalk-delta-client")
+        self._thread.start()
+
+    def stop(self) -> None:
+        self._stop.set()
+
+    def wait_connected(self, timeout: float = 10.0) -> bool:
+        return self._connected.wait(timeout)
+
+    def snapshot(self) -> dict[str, Any]:
+        """A deep copy of the current state tree (REST blob shape)."""
+        with self._lock:
+            return copy.deepcopy(self._state)
+
+    def has_data(self) -> bool:
+        with self._lock:
+            return bool(self._state)
+
+    # ── Delta handling ──────────────────────────────────────────────────────
+
+    def apply_delta(self, delta: dict[str, Any]) -> None:
+        """Fold one delta message into the state tree.
+
+        Each update value {path, value} becomes a {value, timestamp} leaf at
+        the dotted path, matching what the REST endpoint returns, so the rest
+        of the pipeline (filter_stale_data, update_position_cache) works on
+        the snapshot unchanged.
+        """
+        updates = delta.get("updates")
+        if not isinstance(updates, list):
+            return
+        with self._lock:
+            for update in updates:
+                if not isinstance(update, dict):
+                    continue
+                timestamp = update.get("timestamp")
+                for item in update.get("values") or []:
+                    if not isinstance(item, dict):
+                        continue
+                    path = item.get("path")
+                    if not isinstance(path, str) or not path:
+                        continue
+                    if path.split(".", 1)[0] not in self._top_level_keys:
+                        continue
+                    self._set_leaf(path, item.get("value"), timestamp)
+
+    def _set_leaf(self, path: str, value: Any, timestamp: Any) -> None:
+        node = self._state
+        for part in path.split("."):
+            child = node.get(part)
+            if not isinstance(child, dict):
+                child = {}
+                node[part] = child
+            node = child
+        node["value"] = value
+        if isinstance(timestamp, str):
+            node["timestamp"] = timestamp
+
+    # ── Connection loop ─────────────────────────────────────────────────────
+
+    def _subscribe_message(self) -> str:
+        return json.dumps({
+            "context": "vessels.self",
+            "subscribe": [
+                {"path": f"{key}.*", "policy": "instant"}
+                for key in sorted(self._top_level_keys)
+            ],
+        })
+
+    def _run(self) -> None:
+        backoff = RECONNECT_MIN_S
+        while not self._stop.is_set():
+            try:
+                ws = websocket.create_connection(self._stream_url, timeout=30)
+            except Exception as exc:  # noqa: BLE001 - retry with backoff
+                print(f"SignalK stream connect failed: {exc} (retry in {backoff:.0f}s)")
+                if self._stop.wait(backoff):
+                    return
+                backoff = min(backoff * 2, RECONNECT_MAX_S)
+                continue
+
+            backoff = RECONNECT_MIN_S
+            try:
+                ws.send(self._subscribe_message())
+                self._connected.set()
+                print(f"Subscribed to SignalK delta stream at {self._stream_url}")
+                while not self._stop.is_set():
+                    raw = ws.recv()
+                    if not raw:
+                        continue
+                    try:
+                        delta = json.loads(raw)
+                    except json.JSONDecodeError:
+                        continue
+                    if isinstance(delta, dict):
+                        self.apply_delta(delta)
+            except Exception as exc:  # noqa: BLE001 - reconnect on any stream error
+                if not self._stop.is_set():
+                    print(f"SignalK stream dropped: {exc} — reconnecting")
+            finally:
+                self._connected.clear()
+                try:
+                    ws.close()
+                except Exception:
+                    pass
+                if self._stop.wait(backoff):
+                    return
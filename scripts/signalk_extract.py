@@ -0,0 +1,127 @@
+"""Single-pass extraction engine for SignalK blobs.
+
+update_position_cache() used to walk the blob several times per cycle —
+once to collect snapshot {path, value} entries, once to flatten numeric
+instrument readings, and once more with hand-rolled dict digging for the
+navigation point fields. BlobExtractor compiles the wanted branch set once
+at startup and produces all of those outputs in a single recursive
+traversal, so adding a consumer means declaring a path, not writing
+another walk. make_timestamp_parser() gives filter_stale_data() a
+per-cycle memoized ISO-8601 parser, since sibling leaves in one blob
+overwhelmingly share identical timestamp strings.
+"""
+from __future__ import annotations
+
+from datetime import datetime
+from types import SimpleNamespace
+from typing import Any
+
+# Structural keys that are never SignalK sub-branches.
+SKIP_KEYS = frozenset({"value", "meta", "values", "pgn", "$source", "source"})
+
+# Scalar point fields lifted out during the walk; path → result attribute.
+POINT_SCALAR_PATHS = {
+    "navigation.speedOverGround": "speed_over_ground",
+    "navigation.headingTrue": "heading_true",
+    "navigation.courseOverGroundTrue": "course_over_ground",
+    "environment.wind.speedTrue": "wind_speed",
+    "environment.wind.angleTrue": "wind_angle",
+}
+
+
+def make_timestamp_parser():
+    """Return an ISO-8601 parser memoized on the raw timestamp string."""
+    cache: dict[str, datetime | None] = {}
+
+    def parse(value: Any) -> datetime | None:
+        if not isinstance(value, str):
+            return None
+        if value in cache:
+            return cache[value]
+        normalized = value.replace("Z", "+00:00")
+        try:
+            parsed: datetime | None = datetime.fromisoformat(normalized)
+        except ValueError:
+            parsed = None
+        cache[value] = parsed
+        return parsed
+
+    return parse
+
+
+class BlobExtractor:
+    """Compiled single-pass visitor over a SignalK full-tree blob.
+
+    *snapshot_whitelist* bounds which top-level branches contribute to the
+    snapshot values list (matching the old _collect_signalk_values rules:
+    all-numeric object values stay compact, mixed objects flatten to their
+    numeric leaves). Numeric instrument readings and the navigation point
+    fields are collected from every branch regardless, matching the old
+    separate walks.
+    """
+
+    def __init__(self, snapshot_whitelist: frozenset[str]):
+        self._snapshot_whitelist = frozenset(snapshot_whitelist)
+
+    def extract(self, blob: Any) -> SimpleNamespace:
+        result = SimpleNamespace(
+            snapshot_values=[],
+            numeric_values={},
+            latitude=None,
+            longitude=None,
+            position_timestamp=None,
+            engine_rpm=None,
+            **{attr: None for attr in POINT_SCALAR_PATHS.values()},
+        )
+        if not isinstance(blob, dict):
+            return result
+        for key, child in blob.items():
+            if isinstance(child, dict):
+                self._visit(child, key, key in self._snapshot_whitelist, result)
+        return result
+
+    def _visit(
+        self, node: dict[str, Any], path: str, in_snapshot: bool, result: SimpleNamespace
+    ) -> None:
+        value = node.get("value")
+
+        if path == "navigation.position" and isinstance(value, dict):
+            lat, lon = value.get("latitude"), value.get("longitude")
+            if isinstance(lat, (int, float)) and isinstance(lon, (int, float)):
+                result.latitude = lat
+                result.longitude = lon
+                result.position_timestamp = node.get("timestamp")
+
+        if isinstance(value, (int, float)):
+            scalar = float(value)
+            if in_snapshot:
+                result.snapshot_values.append({"path": path, "value": scalar})
+            result.numeric_values[path] = scalar
+            attr = POINT_SCALAR_PATHS.get(path)
+            if attr is not None:
+                setattr(result, attr, value)
+            # Any turning engine counts toward engine hours.
+            parts = path.split(".")
+            if len(parts) == 3 and parts[0] == "propulsion" and parts[2] == "revolutions":
+                result.engine_rpm = max(result.engine_rpm or 0.0, scalar)
+        elif isinstance(value, dict):
+            numeric_leaves = {
+                k: v for k, v in value.items() if isinstance(v, (int, float))
+            }
+            if in_snapshot:
+                if numeric_leaves and len(numeric_leaves) == len(value):
+                    # Every leaf numeric (e.g. position) — keep the object compact.
+                    result.snapshot_values.append({"path": path, "value": numeric_leaves})
+                else:
+                    for k, v in numeric_leaves.items():
+                        result.snapshot_values.append(
+                            {"path": f"{path}.{k}", "value": float(v)}
+                        )
+            for k, v in numeric_leaves.items():
+                result.numeric_values[f"{path}.{k}"] = float(v)
+
+        for key, child in node.items():
+            if key in SKIP_KEYS:
+                continue
+            if isinstance(child, dict):
+                self._visit(child, f"{path}.{key}", in_snapshot, result)
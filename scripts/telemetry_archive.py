@@ -0,0 +1,154 @@
+"""Packed columnar archive for historical telemetry positions.
+
+One append-only binary file per UTC day replaces the per-snapshot JSON files
+for anything older than the current day. Each record is a fixed-width packed
+struct so the browser can read a whole day with a single (optionally ranged)
+fetch and decode it with a DataView — no per-point HTTP requests, no JSON
+parse, and only one inode per day instead of ~500.
+
+Record layout (little-endian, 40 bytes):
+
+    f64  timestamp     — unix seconds, UTC
+    f64  latitude      — degrees (privacy-redacted, same as positions index)
+    f64  longitude     — degrees
+    f32  sog           — speed over ground, m/s (NaN when unavailable)
+    f32  cog           — course over ground, radians (NaN when unavailable)
+    f32  wind_speed    — true wind speed, m/s (NaN when unavailable)
+    f32  wind_angle    — true wind angle, radians (NaN when unavailable)
+
+`archive_index.json` lists the available days with record counts so readers
+never have to probe for files. The JSON snapshot path is unchanged and remains
+the fallback for the current day and for old clients.
+"""
+from __future__ import annotations
+
+import json
+import math
+import struct
+from datetime import UTC, datetime
+from pathlib import Path
+from typing import Any
+
+ARCHIVE_DIR_NAME = "archive"
+ARCHIVE_INDEX_NAME = "archive_index.json"
+
+RECORD_STRUCT = struct.Struct("<dddffff")
+RECORD_SIZE = RECORD_STRUCT.size  # 40 bytes
+
+RECORD_FIELDS = (
+    "timestamp", "latitude", "longitude",
+    "sog", "cog", "wind_speed", "wind_angle",
+)
+
+
+def _day_filename(date_str: str) -> str:
+    return f"{date_str}.bin"
+
+
+def _load_index(index_path: Path) -> dict[str, Any]:
+    if index_path.exists():
+        try:
+            payload = json.loads(index_path.read_text(encoding="utf-8"))
+            if isinstance(payload, dict) and isinstance(payload.get("days"), list):
+                return payload
+        except (json.JSONDecodeError, OSError):
+            pass
+    return {
+        "record_size": RECORD_SIZE,
+        "fields": list(RECORD_FIELDS),
+        "days": [],
+    }
+
+
+def _write_index(index_path: Path, index: dict[str, Any]) -> None:
+    index["days"].sort(key=lambda d: d.get("date") or "")
+    index_path.write_text(json.dumps(index, indent=2), encoding="utf-8")
+
+
+def pack_record(
+    timestamp: datetime,
+    latitude: float,
+    longitude: float,
+    sog: float | None = None,
+    cog: float | None = None,
+    wind_speed: float | None = None,
+    wind_angle: float | None = None,
+) -> bytes:
+    """Pack one telemetry point into the fixed 40-byte record format."""
+    def f32(v: float | None) -> float:
+        return float(v) if isinstance(v, (int, float)) else math.nan
+
+    return RECORD_STRUCT.pack(
+        timestamp.timestamp(),
+        float(latitude),
+        float(longitude),
+        f32(sog), f32(cog), f32(wind_speed), f32(wind_angle),
+    )
+
+
+def unpack_records(data: bytes) -> list[dict[str, Any]]:
+    """Decode a day file back into a list of point dicts (NaN → None)."""
+    points: list[dict[str, Any]] = []
+    for offset in range(0, len(data) - RECORD_SIZE + 1, RECORD_SIZE):
+        values = RECORD_STRUCT.unpack_from(data, offset)
+        point: dict[str, Any] = {}
+        for field, value in zip(RECORD_FIELDS, values):
+            if field == "timestamp":
+                point[field] = datetime.fromtimestamp(value, tz=UTC)
+            else:
+                point[field] = None if math.isnan(value) else value
+        points.append(point)
+    return points
+
+
+def append_record(
+    telemetry_dir: Path,
+    timestamp: datetime,
+    latitude: float,
+    longitude: float,
+    *,
+    sog: float | None = None,
+    cog: float | None = None,
+    wind_speed: float | None = None,
+    wind_angle: float | None = None,
+) -> Path:
+    """Append one point to the day file for *timestamp* and update the index.
+
+    Returns the day file path. Creates the archive directory, day file, and
+    index on first use.
+    """
+    archive_dir = telemetry_dir / ARCHIVE_DIR_NAME
+    archive_dir.mkdir(parents=True, exist_ok=True)
+
+    date_str = timestamp.astimezone(UTC).strftime("%Y-%m-%d")
+    day_path = archive_dir / _day_filename(date_str)
+    record = pack_record(
+        timestamp, latitude, longitude,
+        sog=sog, cog=cog, wind_speed=wind_speed, wind_angle=wind_angle,
+    )
+    with day_path.open("ab") as f:
+        f.write(record)
+
+    index_path = archive_dir / ARCHIVE_INDEX_NAME
+    index = _load_index(index_path)
+    records = day_path.stat().st_size // RECORD_SIZE
+    for day in index["days"]:
+        if day.get("date") == date_str:
+            day["records"] = records
+            break
+    else:
+        index["days"].append({
+            "date": date_str,
+            "file": _day_filename(date_str),
+            "records": records,
+        })
+    _write_index(index_path, index)
+    return day_path
+
+
+def read_day(telemetry_dir: Path, date_str: str) -> list[dict[str, Any]]:
+    """Read every archived point for a UTC day; empty list if absent."""
+    day_path = telemetry_dir / ARCHIVE_DIR_NAME / _day_filename(date_str)
+    if not day_path.exists():
+        return []
+    return unpack_records(day_path.read_bytes())
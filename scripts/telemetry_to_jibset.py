@@ -5,8 +5,11 @@ from __future__ import annotations
 import argparse
 import csv
 import json
+import os
 import re
+import time
 from collections.abc import Iterable
+from multiprocessing import Pool
 from dataclasses import dataclass
 from datetime import datetime, timedelta, timezone
 from pathlib import Path
@@ -101,12 +104,34 @@ def iter_telemetry_files(input_dir: Path) -> Iterable[Path]:
         yield path
 
 
-def collect_points(files: Iterable[Path]) -> list[TrackPoint]:
-    points: List[TrackPoint] = []
-    for path in files:
-        point = load_point(path)
-        if point:
-            points.append(point)
+def collect_points(files: Iterable[Path], jobs: int = 1, progress: bool = False) -> list[TrackPoint]:
+    file_list = list(files)
+    points: list[TrackPoint] = []
+    started = time.monotonic()
+
+    def note_progress(done: int) -> None:
+        if not progress or done == 0 or (done % 1000 and done != len(file_list)):
+            return
+        elapsed = time.monotonic() - started
+        rate = done / elapsed if elapsed > 0 else 0.0
+        remaining = (len(file_list) - done) / rate if rate > 0 else 0.0
+        print(f"  {done}/{len(file_list)} files ({rate:.0f}/s, ~{remaining:.0f}s left)")
+
+    if jobs > 1 and len(file_list) > 1:
+        # Per-file parsing is independent, so fan it out across a pool.
+        # imap preserves input order, keeping the merge deterministic before
+        # the final timestamp sort.
+        with Pool(processes=jobs) as pool:
+            for done, point in enumerate(pool.imap(load_point, file_list, chunksize=64), start=1):
+                if point:
+                    points.append(point)
+                note_progress(done)
+    else:
+        for done, path in enumerate(file_list, start=1):
+            point = load_point(path)
+            if point:
+                points.append(point)
+            note_progress(done)
     points.sort(key=lambda p: p.timestamp)
     return points
 
@@ -230,11 +255,17 @@ def main() -> int:
         default="Jibset Track",
         help="Track name for GPX output",
     )
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=min(4, os.cpu_count() or 1),
+        help="Worker processes for snapshot parsing (default: up to 4)",
+    )
 
     args = parser.parse_args()
     input_dir = Path(args.input_dir)
     files = list(iter_telemetry_files(input_dir))
-    points = collect_points(files)
+    points = collect_points(files, jobs=max(1, args.jobs), progress=True)
     if not points:
         raise SystemExit("No telemetry points found.")
 
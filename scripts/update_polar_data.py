@@ -25,11 +25,19 @@ from .utils import get_project_root, load_vessel_info
 
 ACCUMULATOR_FILE = "data/vessel/polars_accumulated.json"
 POLAR_CSV_FILE = "data/vessel/polars_calculated.csv"
+POLAR_GRID_FILE = "data/vessel/polars_grid.json"
 
 # Output grid — same TWS columns as polars.csv for drop-in frontend compatibility.
 OUTPUT_TWS: list[int] = [4, 6, 8, 10, 12, 14, 16, 20, 24]
 OUTPUT_TWA: list[int] = [0, 52, 60, 75, 90, 110, 120, 135, 150]
 
+# Dense grid emitted alongside the CSV: fixed bins, bilinearly interpolated
+# from the coarse table so the frontend can index it in O(1) per lookup.
+GRID_TWA_STEP = 5   # degrees, 0–180 inclusive → 37 rows
+GRID_TWS_MIN = 2    # knots
+GRID_TWS_MAX = 30   # knots, 1-knot steps → 29 columns
+GRID_TWS_STEP = 1
+
 # Accumulator bin resolution
 TWA_BIN_SIZE = 5  # degrees
 TWS_BIN_SIZE = 2  # knots
@@ -122,6 +130,57 @@ def write_polar_csv(acc: dict, path: Path) -> None:
     path.write_text("\n".join(lines) + "\n")
 
 
+def _interp_1d(grid: list[int], target: float) -> tuple[int, int, float]:
+    """Return (lower index, upper index, fraction) for linear interpolation."""
+    if target <= grid[0]:
+        return 0, 0, 0.0
+    if target >= grid[-1]:
+        return len(grid) - 1, len(grid) - 1, 0.0
+    for i in range(len(grid) - 1):
+        if grid[i] <= target <= grid[i + 1]:
+            span = grid[i + 1] - grid[i]
+            return i, i + 1, (target - grid[i]) / span if span else 0.0
+    return len(grid) - 1, len(grid) - 1, 0.0
+
+
+def build_dense_grid(acc: dict) -> dict:
+    """Bilinearly interpolate the coarse output table onto a fixed dense grid.
+
+    Rows are TWA 0–180° in GRID_TWA_STEP steps, columns TWS
+    GRID_TWS_MIN–GRID_TWS_MAX knots in GRID_TWS_STEP steps. The frontend
+    loads the values into a typed array and turns each getPolarSpeed() call
+    into one index computation instead of a row scan.
+    """
+    coarse = [
+        [_best_speed(acc, float(twa), float(tws)) for tws in OUTPUT_TWS]
+        for twa in OUTPUT_TWA
+    ]
+    rows = []
+    for twa in range(0, 181, GRID_TWA_STEP):
+        a0, a1, fa = _interp_1d(OUTPUT_TWA, float(twa))
+        row = []
+        for tws in range(GRID_TWS_MIN, GRID_TWS_MAX + 1, GRID_TWS_STEP):
+            s0, s1, fs = _interp_1d(OUTPUT_TWS, float(tws))
+            low = coarse[a0][s0] + (coarse[a0][s1] - coarse[a0][s0]) * fs
+            high = coarse[a1][s0] + (coarse[a1][s1] - coarse[a1][s0]) * fs
+            row.append(round(low + (high - low) * fa, 2))
+        rows.append(row)
+    return {
+        "twa_step": GRID_TWA_STEP,
+        "twa_max": 180,
+        "tws_min": GRID_TWS_MIN,
+        "tws_max": GRID_TWS_MAX,
+        "tws_step": GRID_TWS_STEP,
+        "values": rows,
+    }
+
+
+def write_polar_grid(acc: dict, path: Path) -> None:
+    """Write the dense interpolation grid next to polars_calculated.csv."""
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(json.dumps(build_dense_grid(acc), separators=(",", ":")))
+
+
 def _get_value(node: dict, *path: str) -> float | None:
     """Traverse a nested SignalK dict and return the leaf .value, or None."""
     for key in path:
@@ -189,6 +248,14 @@ def parse_args() -> SimpleNamespace:
         default=10,
         help="Sampling interval in seconds (0 = one-shot)",
     )
+    parser.add_argument(
+        "--flush-interval",
+        dest="flush_interval",
+        type=int,
+        default=0,
+        help="Seconds between accumulator/CSV flushes (0 = write on every"
+        " improvement). Lets --interval 1 sample at ~1 Hz without disk churn.",
+    )
     parser.add_argument("--accumulator", default=ACCUMULATOR_FILE)
     parser.add_argument("--output", default=POLAR_CSV_FILE)
     return parser.parse_args()
@@ -214,27 +281,58 @@ def main() -> int:
         f"{len(acc.get('bins', {}))} bins populated"
     )
 
-    while True:
-        sample = fetch_polar_sample(args.signalk_url)
-        if sample is not None:
-            twa_deg, tws_kts, stw_kts = sample
-            improved = update_accumulator(acc, twa_deg, tws_kts, stw_kts)
-            if improved:
-                save_accumulator(acc, acc_path)
-                write_polar_csv(acc, csv_path)
-                print(
-                    f"New max: TWA={_twa_bin(twa_deg)}° TWS={_tws_bin(tws_kts)}kts "
-                    f"→ {stw_kts:.2f}kts | {acc['observations']} total observations"
-                )
-            else:
+    # With a flush interval, improvements accumulate in memory and hit disk
+    # every few minutes instead of on every sample — so --interval 1 can run
+    # at ~1 Hz (catching gusts the 10 s cadence misses) with no extra churn.
+    dirty = False
+    last_flush = time.monotonic()
+
+    grid_path = csv_path.parent / Path(POLAR_GRID_FILE).name
+
+    def flush() -> None:
+        nonlocal dirty, last_flush
+        save_accumulator(acc, acc_path)
+        write_polar_csv(acc, csv_path)
+        write_polar_grid(acc, grid_path)
+        dirty = False
+        last_flush = time.monotonic()
+
+    try:
+        while True:
+            sample = fetch_polar_sample(args.signalk_url)
+            if sample is not None:
+                twa_deg, tws_kts, stw_kts = sample
+                improved = update_accumulator(acc, twa_deg, tws_kts, stw_kts)
+                if improved:
+                    print(
+                        f"New max: TWA={_twa_bin(twa_deg)}° TWS={_tws_bin(tws_kts)}kts "
+                        f"→ {stw_kts:.2f}kts | {acc['observations']} total observations"
+                    )
+                    if args.flush_interval > 0:
+                        dirty = True
+                    else:
+                        flush()
+                elif args.interval >= 5:
+                    # Suppressed at high sample rates to keep the journal quiet.
+                    print(
+                        f"Sample: TWA={twa_deg:.1f}° TWS={tws_kts:.1f}kts "
+                        f"STW={stw_kts:.2f}kts (no improvement)"
+                    )
+
+            if dirty and time.monotonic() - last_flush >= args.flush_interval:
+                flush()
                 print(
-                    f"Sample: TWA={twa_deg:.1f}° TWS={tws_kts:.1f}kts "
-                    f"STW={stw_kts:.2f}kts (no improvement)"
+                    f"Flushed accumulator: {acc['observations']} observations, "
+                    f"{len(acc['bins'])} bins populated"
                 )
 
-        if args.interval == 0:
-            break
-        time.sleep(args.interval)
+            if args.interval == 0:
+                break
+            time.sleep(args.interval)
+    finally:
+        # Don't lose in-memory improvements on shutdown (systemctl stop, ^C).
+        if dirty:
+            flush()
     return 0
 
 
@@ -12,6 +12,8 @@ from typing import Any
 
 import requests
 
+from . import prefetch_forecast_bundle, prefetch_tide_predictions, reverse_geocode, telemetry_archive
+from .signalk_extract import BlobExtractor, make_timestamp_parser
 from .utils import get_project_root, load_vessel_info
 
 DEFAULT_OUTPUT_FILE = "./data/telemetry/signalk_latest.json"
@@ -19,10 +21,21 @@ STALE_MAX_AGE_MINUTES = 60
 STALE_FILTER_KEYS = ("environment", "navigation", "entertainment")
 POSITION_RETENTION_HOURS = 24  # keep raw snapshot files for 24 hours only
 POSITION_INDEX_FILE = "./data/telemetry/positions_index.json"
+POSITION_INDEX_PAGES_DIR = "./data/telemetry/positions_index_pages"
 INSTRUMENT_LOG_FILE = "./data/telemetry/instrument_log.json"
 INSTRUMENT_LOG_ENTRIES = 120  # ~5 hours at the default 2.5-min update cadence
+INSTRUMENT_LOG_SHARD_DIR = "./data/telemetry/instrument_log"
+INSTRUMENT_LOG_SHARD_ENTRIES = 600  # cap per daily shard (~25 h at 2.5-min cadence)
+INSTRUMENT_LOG_RETENTION_DAYS = 7   # shards older than this are deleted
 TRACKS_DIR = "./data/telemetry/tracks"
 TRACKS_INDEX_FILE = "./data/telemetry/tracks_index.json"
+VOYAGE_STATS_FILE = "./data/telemetry/voyage_stats.json"
+VOYAGE_UNDERWAY_MIN_SPEED_MS = 0.5   # ≈1 kt — below this the boat is drifting/moored
+VOYAGE_MAX_FOLD_GAP_MINUTES = 30     # gaps longer than this are outages, not sailing
+VOYAGE_SAILING_DAY_MIN_NM = 0.5      # a "sailing day" moved at least this far
+UPDATE_METRICS_FILE = "./data/telemetry/update_metrics.json"
+UPDATE_METRICS_MAX_CYCLES = 50       # rolling window of per-cycle stage timings
+RETENTION_MANIFEST_FILE = "./data/telemetry/retention_manifest.json"
 
 _NS_GPX = "http://www.topografix.com/GPX/1/1"
 _NS_GPXTPX = "http://www.garmin.com/xmlschemas/TrackPointExtension/v1"
@@ -32,11 +45,57 @@ ET.register_namespace("gpxtpx", _NS_GPXTPX)
 # Used by the frontend sparkline feature to load historical telemetry for all paths.
 SNAPSHOT_INDEX_FILE = "./data/telemetry/snapshots_index.json"
 
+# Declarative path manifest shared with the frontend (assets/app.js fetches
+# the same file). blob_branches/root_attributes bound what signalk_latest.json
+# keeps; snapshot_branches bound per-snapshot archives and the delta-stream
+# subscription. The fallback matches the manifest committed in the repo.
+PATH_MANIFEST_FILE = "data/signalk_paths.json"
+_FALLBACK_PATH_MANIFEST: dict[str, Any] = {
+    "blob_branches": [
+        "communication", "design", "electrical", "environment", "internet",
+        "navigation", "propulsion", "steering", "tanks",
+    ],
+    "root_attributes": ["name", "mmsi"],
+    "snapshot_branches": [
+        "navigation", "environment", "electrical", "tanks", "propulsion", "internet"
+    ],
+    "point_paths": {
+        "position": "navigation.position",
+        "speed": "navigation.speedOverGround",
+        "course": "navigation.courseOverGroundTrue",
+    },
+}
+
+
+def _load_path_manifest(path: Path | None = None) -> dict[str, Any]:
+    """Load the path manifest, falling back to the built-in copy on any error."""
+    manifest = dict(_FALLBACK_PATH_MANIFEST)
+    try:
+        manifest_path = path or get_project_root() / PATH_MANIFEST_FILE
+        loaded = json.loads(manifest_path.read_text(encoding="utf-8"))
+        if isinstance(loaded, dict):
+            for key, fallback in _FALLBACK_PATH_MANIFEST.items():
+                value = loaded.get(key)
+                if isinstance(value, type(fallback)) and value:
+                    manifest[key] = value
+    except (json.JSONDecodeError, OSError):
+        pass
+    return manifest
+
+
+PATH_MANIFEST: dict[str, Any] = _load_path_manifest()
+
 # Top-level SignalK keys to include in compressed position archives.
 # Excludes static design data, raw sensor hardware keys, and AIS bounding boxes.
-SNAPSHOT_PATH_WHITELIST: frozenset[str] = frozenset({
-    "navigation", "environment", "electrical", "tanks", "propulsion", "internet"
-})
+SNAPSHOT_PATH_WHITELIST: frozenset[str] = frozenset(PATH_MANIFEST["snapshot_branches"])
+# Keys the committed blob (signalk_latest.json) retains — everything else in
+# the SignalK tree is dropped before the write so it never hits git.
+BLOB_KEY_WHITELIST: frozenset[str] = frozenset(
+    PATH_MANIFEST["blob_branches"]
+) | frozenset(PATH_MANIFEST["root_attributes"])
+# Compiled once at startup; one extract() walk per cycle replaces the old
+# separate snapshot/numeric/point traversals of the same tree.
+BLOB_EXTRACTOR = BlobExtractor(SNAPSHOT_PATH_WHITELIST)
 
 # Fallback privacy zone used when none are defined in info.yaml.
 _FALLBACK_PRIVACY_ZONES: list[tuple[float, float, float]] = [
@@ -146,12 +205,41 @@ def parse_args() -> SimpleNamespace:
         default=os.getenv("USE_HTTPS", "false").lower() == "true",
         help="Use HTTPS instead of HTTP for SignalK connection",
     )
+    parser.add_argument(
+        "--websocket",
+        dest="websocket",
+        action="store_true",
+        default=os.getenv("USE_WEBSOCKET", "false").lower() == "true",
+        help="Subscribe to the SignalK delta stream instead of polling the REST API"
+        " (requires --interval > 0)",
+    )
     parser.add_argument(
         "--no-push",
         dest="no_push",
         action="store_true",
         default=os.getenv("NO_PUSH", "false").lower() == "true",
     )
+    parser.add_argument(
+        "--batch-size",
+        dest="batch_size",
+        type=int,
+        default=int(os.getenv("BATCH_SIZE", "1")),
+        help="Snapshots to commit locally before pushing (1 pushes every cycle)",
+    )
+    parser.add_argument(
+        "--batch-minutes",
+        dest="batch_minutes",
+        type=float,
+        default=float(os.getenv("BATCH_MINUTES", "0")),
+        help="Push at least this often while batching (0 disables the timer)",
+    )
+    parser.add_argument(
+        "--push-distance-m",
+        dest="push_distance_m",
+        type=float,
+        default=float(os.getenv("PUSH_DISTANCE_M", "500")),
+        help="Push immediately when the vessel moves this far since the last push",
+    )
     return parser.parse_args()
 
 
@@ -176,15 +264,8 @@ def filter_stale_data(
         return blob
 
     cutoff = (reference_time or datetime.now(UTC)) - timedelta(minutes=max_age_minutes)
-
-    def parse_timestamp(ts: Any) -> datetime | None:
-        if not isinstance(ts, str):
-            return None
-        normalized = ts.replace("Z", "+00:00")
-        try:
-            return datetime.fromisoformat(normalized)
-        except ValueError:
-            return None
+    # Sibling leaves share identical timestamp strings, so memoize per call.
+    parse_timestamp = make_timestamp_parser()
 
     def prune(node: Any) -> Any:
         if isinstance(node, dict):
@@ -223,11 +304,28 @@ def filter_stale_data(
     return blob
 
 
+def prune_blob_to_manifest(blob: dict[str, Any]) -> dict[str, Any]:
+    """Drop top-level keys the manifest does not whitelist.
+
+    The full SignalK tree carries branches we never render (sensors, AIS
+    notifications, raw hardware keys); dropping them before the write shrinks
+    the committed blob, its git deltas, and every browser fetch. Blobs that do
+    not look like a SignalK tree (no whitelisted branch present) pass through
+    unchanged so odd payloads are still captured for debugging.
+    """
+    if not isinstance(blob, dict):
+        return blob
+    if not any(key in BLOB_KEY_WHITELIST for key in blob):
+        return blob
+    return {key: value for key, value in blob.items() if key in BLOB_KEY_WHITELIST}
+
+
 def git_commit_and_push(no_push: bool, remote: str, branch: str) -> None:
     subprocess.run(["git", "add", "data/telemetry"], check=True)
-    polar_csv = get_project_root() / "data/vessel/polars_calculated.csv"
-    if polar_csv.exists():
-        subprocess.run(["git", "add", str(polar_csv)], check=True)
+    for polar_name in ("polars_calculated.csv", "polars_grid.json"):
+        polar_file = get_project_root() / "data/vessel" / polar_name
+        if polar_file.exists():
+            subprocess.run(["git", "add", str(polar_file)], check=True)
     nothing_staged = subprocess.run(["git", "diff", "--cached", "--quiet"]).returncode == 0
     if nothing_staged:
         return
@@ -237,6 +335,10 @@ def git_commit_and_push(no_push: bool, remote: str, branch: str) -> None:
     )
     if no_push:
         return
+    git_push(remote=remote, branch=branch)
+
+
+def git_push(remote: str, branch: str) -> None:
     push_cmd = ["git", "push", remote, branch]
     try:
         subprocess.run(push_cmd, check=True)
@@ -252,6 +354,42 @@ def git_commit_and_push(no_push: bool, remote: str, branch: str) -> None:
             print(f"Push deferred (offline or merge conflict): {e}")
 
 
+def _should_flush_batch(
+    pending: int,
+    elapsed_minutes: float,
+    moved_m: float | None,
+    *,
+    batch_size: int,
+    batch_minutes: float,
+    push_distance_m: float,
+) -> bool:
+    """Decide whether a batched run should push its accumulated commits now.
+
+    Triggers: the batch is full, the batch timer expired, or the vessel moved
+    far enough since the last push that the map would be visibly stale.
+    """
+    if pending >= batch_size:
+        return True
+    if batch_minutes > 0 and elapsed_minutes >= batch_minutes:
+        return True
+    if push_distance_m > 0 and moved_m is not None and moved_m >= push_distance_m:
+        return True
+    return False
+
+
+def _read_blob_position(path: Path) -> tuple[float, float] | None:
+    """Read the (privacy-redacted) display position back from a written blob."""
+    try:
+        blob = json.loads(path.read_text(encoding="utf-8"))
+        pos = blob.get("navigation", {}).get("position", {}).get("value", {})
+        lat, lon = pos.get("latitude"), pos.get("longitude")
+        if isinstance(lat, (int, float)) and isinstance(lon, (int, float)):
+            return float(lat), float(lon)
+    except (json.JSONDecodeError, OSError, AttributeError):
+        pass
+    return None
+
+
 def _parse_timestamp(value: Any) -> datetime | None:
     if not isinstance(value, str):
         return None
@@ -269,7 +407,7 @@ def _format_position_filename(timestamp: datetime) -> str:
 def _parse_position_filename(name: str) -> datetime | None:
     if not name.endswith("Z.json"):
         return None
-    stem = name[:-5]
+    stem = name[: -len("Z.json")]
     try:
         return datetime.strptime(stem, "%Y-%m-%dT%H-%M-%S.%f")
     except ValueError:
@@ -295,77 +433,44 @@ def _write_position_index(path: Path, entries: list[dict[str, Any]]) -> None:
     path.write_text(json.dumps(payload, indent=2), encoding="utf-8")
 
 
-def _collect_signalk_values(
-    node: Any,
-    path: str,
-    *,
-    values: list[dict[str, Any]],
-    whitelist: frozenset[str] | None = None,
-) -> None:
-    """Collect SignalK paths and values as a list of {path, value} dicts.
+def _archive_position_entries(output_dir: Path, expired: list[dict[str, Any]]) -> None:
+    """Move entries pruned from the head index into monthly archive pages.
 
-    At the top level (path="") the optional *whitelist* restricts which
-    top-level keys are traversed.  Object-valued nodes whose every leaf is
-    numeric (e.g. navigation.position) are emitted as a single object entry
-    rather than being flattened into individual scalar entries.
+    positions_index.json stays a few KB (just the breadcrumb window) while
+    positions_index_pages/YYYY-MM.json keeps the pruned history fetchable on
+    demand; manifest.json lists the available pages.
     """
-    if not isinstance(node, dict):
+    if not expired:
         return
+    pages_dir = output_dir / Path(POSITION_INDEX_PAGES_DIR).name
+    pages_dir.mkdir(parents=True, exist_ok=True)
 
-    # Top-level: optionally restrict to whitelisted keys only.
-    if not path:
-        keys = (k for k in node if not whitelist or k in whitelist)
-        for key in keys:
-            child = node[key]
-            if isinstance(child, dict):
-                _collect_signalk_values(child, key, values=values)
-        return
+    by_month: dict[str, list[dict[str, Any]]] = {}
+    for entry in expired:
+        ts = entry.get("timestamp") or ""
+        if isinstance(ts, str) and len(ts) >= 7:
+            by_month.setdefault(ts[:7], []).append(entry)
 
-    value = node.get("value")
-    if isinstance(value, (int, float)):
-        values.append({"path": path, "value": float(value)})
-    elif isinstance(value, dict):
-        # If every leaf is numeric, emit as a compact object (e.g. position).
-        numeric_leaves = {k: v for k, v in value.items() if isinstance(v, (int, float))}
-        if numeric_leaves and len(numeric_leaves) == len(value):
-            values.append({"path": path, "value": numeric_leaves})
-        else:
-            for k, v in value.items():
-                if isinstance(v, (int, float)):
-                    values.append({"path": f"{path}.{k}", "value": float(v)})
+    manifest_path = pages_dir / "manifest.json"
+    try:
+        pages = json.loads(manifest_path.read_text(encoding="utf-8")).get("pages", []) if manifest_path.exists() else []
+        if not isinstance(pages, list):
+            pages = []
+    except (json.JSONDecodeError, OSError, AttributeError):
+        pages = []
+    by_page = {p.get("month"): p for p in pages if isinstance(p, dict)}
 
-    for key, child in node.items():
-        if key in {"value", "meta", "values", "pgn", "$source", "source"}:
-            continue
-        if isinstance(child, dict):
-            _collect_signalk_values(child, f"{path}.{key}", values=values)
+    for month, new_entries in by_month.items():
+        page_path = pages_dir / f"{month}.json"
+        existing = _load_position_index(page_path)
+        seen = {e.get("timestamp") for e in existing}
+        existing.extend(e for e in new_entries if e.get("timestamp") not in seen)
+        existing.sort(key=lambda e: e.get("timestamp") or "")
+        _write_position_index(page_path, existing)
+        by_page[month] = {"month": month, "file": page_path.name, "entries": len(existing)}
 
-
-def _collect_numeric_values(
-    node: Any,
-    path: str,
-    *,
-    values: dict[str, float],
-) -> None:
-    if not isinstance(node, dict):
-        return
-
-    value = node.get("value")
-    if isinstance(value, (int, float)):
-        if path:
-            values[path] = float(value)
-    elif isinstance(value, dict):
-        for key, subvalue in value.items():
-            if isinstance(subvalue, (int, float)):
-                subpath = f"{path}.{key}" if path else key
-                values[subpath] = float(subvalue)
-
-    for key, child in node.items():
-        if key in {"value", "meta", "values", "pgn", "$source", "source"}:
-            continue
-        if isinstance(child, dict):
-            child_path = f"{path}.{key}" if path else key
-            _collect_numeric_values(child, child_path, values=values)
+    manifest = sorted(by_page.values(), key=lambda p: p.get("month") or "")
+    manifest_path.write_text(json.dumps({"pages": manifest}, separators=(",", ":")), encoding="utf-8")
 
 
 def _update_snapshot_index(output_dir: Path, filename: str, timestamp: datetime) -> None:
@@ -393,11 +498,14 @@ def _update_snapshot_index(output_dir: Path, filename: str, timestamp: datetime)
     index_path.write_text(json.dumps(existing, indent=2), encoding="utf-8")
 
 
-def _update_instrument_log(output_dir: Path, timestamp: datetime, blob: dict[str, Any]) -> None:
+def _update_instrument_log(
+    output_dir: Path, timestamp: datetime, numeric: dict[str, float]
+) -> None:
     """Append a compact numeric reading to instrument_log.json and trim to the last N entries.
 
     The log replaces the old pattern of fetching N individual snapshot files for sparklines.
-    Each entry is {timestamp, values: {signalk.path: float}} — only numeric leaf values.
+    Each entry is {timestamp, values: {signalk.path: float}} — only numeric leaf values,
+    pre-flattened by the blob extractor.
     """
     log_path = output_dir / Path(INSTRUMENT_LOG_FILE).name
     try:
@@ -407,25 +515,248 @@ def _update_instrument_log(output_dir: Path, timestamp: datetime, blob: dict[str
     except (json.JSONDecodeError, OSError, AttributeError):
         existing = []
 
-    numeric: dict[str, float] = {}
-    _collect_numeric_values(blob, "", values=numeric)
-
     existing.append({"timestamp": timestamp.isoformat(), "values": numeric})
     trimmed = existing[-INSTRUMENT_LOG_ENTRIES:]
     log_path.write_text(json.dumps({"entries": trimmed}, separators=(",", ":")), encoding="utf-8")
 
+    _append_instrument_shard(output_dir, timestamp, numeric)
+
+
+def _append_instrument_shard(output_dir: Path, timestamp: datetime,
+                             numeric: dict[str, float]) -> None:
+    """Append a reading to the per-day instrument shard and refresh the manifest.
+
+    Shards (instrument_log/YYYY-MM-DD.json) let the frontend download only the
+    days covering its sparkline window instead of one ever-growing log file.
+    The single-file log above stays as the fallback for cached old clients.
+    """
+    shard_dir = output_dir / Path(INSTRUMENT_LOG_SHARD_DIR).name
+    shard_dir.mkdir(parents=True, exist_ok=True)
+    date_str = timestamp.astimezone(UTC).strftime("%Y-%m-%d")
+    shard_path = shard_dir / f"{date_str}.json"
+    try:
+        entries: list[dict[str, Any]] = json.loads(shard_path.read_text(encoding="utf-8")).get("entries", []) if shard_path.exists() else []
+        if not isinstance(entries, list):
+            entries = []
+    except (json.JSONDecodeError, OSError, AttributeError):
+        entries = []
+    entries.append({"timestamp": timestamp.isoformat(), "values": numeric})
+    entries = entries[-INSTRUMENT_LOG_SHARD_ENTRIES:]
+    shard_path.write_text(json.dumps({"entries": entries}, separators=(",", ":")), encoding="utf-8")
+
+    # Update the manifest in place; drop (and delete) shards past retention.
+    manifest_path = shard_dir / "manifest.json"
+    try:
+        shards: list[dict[str, Any]] = json.loads(manifest_path.read_text(encoding="utf-8")).get("shards", []) if manifest_path.exists() else []
+        if not isinstance(shards, list):
+            shards = []
+    except (json.JSONDecodeError, OSError, AttributeError):
+        shards = []
+
+    cutoff = (timestamp.astimezone(UTC) - timedelta(days=INSTRUMENT_LOG_RETENTION_DAYS)).strftime("%Y-%m-%d")
+    kept: list[dict[str, Any]] = []
+    for shard in shards:
+        shard_date = shard.get("date")
+        if not isinstance(shard_date, str) or shard_date == date_str:
+            continue
+        if shard_date < cutoff:
+            (shard_dir / f"{shard_date}.json").unlink(missing_ok=True)
+            continue
+        kept.append(shard)
+    kept.append({"date": date_str, "file": shard_path.name, "entries": len(entries)})
+    kept.sort(key=lambda s: s["date"])
+    manifest_path.write_text(json.dumps({"shards": kept}, separators=(",", ":")), encoding="utf-8")
+
+
+def _update_voyage_stats(
+    output_dir: Path,
+    timestamp: datetime,
+    lat: float,
+    lon: float,
+    speed_ms: float | None,
+    engine_rpm: float | None,
+) -> None:
+    """Fold one snapshot into the incremental voyage statistics rollup.
+
+    voyage_stats.json holds lifetime aggregates (distance, time underway,
+    engine hours, speeds) plus per-day rows, so the frontend renders rich
+    stats from one tiny fetch instead of deriving shallow numbers from the
+    tracks index. Gaps longer than VOYAGE_MAX_FOLD_GAP_MINUTES (service
+    outages, harbor stays) contribute neither distance nor time.
+    """
+    stats_path = output_dir / Path(VOYAGE_STATS_FILE).name
+    try:
+        stats = json.loads(stats_path.read_text(encoding="utf-8")) if stats_path.exists() else {}
+        if not isinstance(stats, dict):
+            stats = {}
+    except (json.JSONDecodeError, OSError):
+        stats = {}
+    days: dict[str, Any] = stats.get("days") if isinstance(stats.get("days"), dict) else {}
+    last = stats.get("last") if isinstance(stats.get("last"), dict) else None
+
+    timestamp = timestamp.astimezone(UTC)
+    date_str = timestamp.strftime("%Y-%m-%d")
+    day = days.setdefault(date_str, {
+        "distance_nm": 0.0, "underway_hours": 0.0, "engine_hours": 0.0,
+        "max_speed_kts": 0.0, "samples": 0,
+    })
+    day["samples"] = int(day.get("samples", 0)) + 1
+    speed_kts = speed_ms * 1.94384 if isinstance(speed_ms, (int, float)) else None
+    if speed_kts is not None:
+        day["max_speed_kts"] = round(max(day.get("max_speed_kts", 0.0), speed_kts), 1)
+
+    gap_s = None
+    if last is not None:
+        prev_ts = _parse_timestamp(last.get("timestamp"))
+        if prev_ts is not None:
+            gap_s = (timestamp - prev_ts).total_seconds()
+    if gap_s is not None and 0 < gap_s <= VOYAGE_MAX_FOLD_GAP_MINUTES * 60:
+        if isinstance(last.get("latitude"), (int, float)) and isinstance(last.get("longitude"), (int, float)):
+            moved_nm = _haversine_m(last["latitude"], last["longitude"], lat, lon) / 1852.0
+            day["distance_nm"] = round(day.get("distance_nm", 0.0) + moved_nm, 3)
+        if isinstance(speed_ms, (int, float)) and speed_ms >= VOYAGE_UNDERWAY_MIN_SPEED_MS:
+            day["underway_hours"] = round(day.get("underway_hours", 0.0) + gap_s / 3600, 3)
+        if isinstance(engine_rpm, (int, float)) and engine_rpm > 0:
+            day["engine_hours"] = round(day.get("engine_hours", 0.0) + gap_s / 3600, 3)
+
+    sailing_days = sorted(
+        d for d, row in days.items()
+        if isinstance(row, dict) and row.get("distance_nm", 0.0) >= VOYAGE_SAILING_DAY_MIN_NM
+    )
+    total_nm = sum(row.get("distance_nm", 0.0) for row in days.values() if isinstance(row, dict))
+    underway_h = sum(row.get("underway_hours", 0.0) for row in days.values() if isinstance(row, dict))
+    stats.update({
+        "updated": timestamp.isoformat(),
+        "days": days,
+        "last": {"timestamp": timestamp.isoformat(), "latitude": lat, "longitude": lon},
+        "totals": {
+            "sailing_days": len(sailing_days),
+            "distance_nm": round(total_nm, 1),
+            "underway_hours": round(underway_h, 1),
+            "engine_hours": round(sum(row.get("engine_hours", 0.0) for row in days.values()
+                                      if isinstance(row, dict)), 1),
+            "max_speed_kts": round(max((row.get("max_speed_kts", 0.0) for row in days.values()
+                                        if isinstance(row, dict)), default=0.0), 1),
+            "avg_speed_kts": round(total_nm / underway_h, 1) if underway_h > 0 else 0.0,
+            "first_sail": sailing_days[0] if sailing_days else None,
+            "last_sail": sailing_days[-1] if sailing_days else None,
+        },
+    })
+    stats_path.write_text(json.dumps(stats, separators=(",", ":")), encoding="utf-8")
+
+
+def _load_retention_manifest(output_dir: Path) -> list[str]:
+    """Snapshot filenames awaiting retirement, oldest first.
+
+    A missing or corrupt manifest triggers a one-time directory scan to
+    rebuild it — the migration path for telemetry trees written before the
+    manifest existed.
+    """
+    manifest_path = output_dir / Path(RETENTION_MANIFEST_FILE).name
+    if manifest_path.exists():
+        try:
+            payload = json.loads(manifest_path.read_text(encoding="utf-8"))
+            if isinstance(payload, dict) and isinstance(payload.get("files"), list):
+                return [f for f in payload["files"] if isinstance(f, str)]
+        except (json.JSONDecodeError, OSError):
+            print(f"Warning: could not parse {manifest_path}, rebuilding from directory scan")
+    names = [
+        p.name for p in output_dir.iterdir()
+        if p.is_file() and _parse_position_filename(p.name) is not None
+    ]
+    # The filename format is zero-padded ISO, so lexical order is time order.
+    names.sort()
+    return names
+
+
+def _write_retention_manifest(output_dir: Path, files: list[str]) -> None:
+    manifest_path = output_dir / Path(RETENTION_MANIFEST_FILE).name
+    manifest_path.write_text(
+        json.dumps({"files": files}, separators=(",", ":")), encoding="utf-8"
+    )
+
+
+def _record_snapshot_for_retention(output_dir: Path, filename: str) -> None:
+    """Register a freshly written snapshot file with the retention manifest."""
+    files = _load_retention_manifest(output_dir)
+    if filename not in files:
+        files.append(filename)
+    _write_retention_manifest(output_dir, files)
+
+
+def _fold_snapshot_into_archive(output_dir: Path, snapshot_path: Path, ts: datetime) -> None:
+    """Ensure a retiring snapshot's point exists in the packed daily archive.
+
+    Normally the record was appended at capture time, so this is just a cheap
+    membership check; it only re-packs data for snapshots that predate the
+    archive or were written while it was failing.
+    """
+    date_str = ts.astimezone(UTC).strftime("%Y-%m-%d")
+    existing = {
+        round(pt["timestamp"].timestamp(), 3)
+        for pt in telemetry_archive.read_day(output_dir, date_str)
+    }
+    if round(ts.timestamp(), 3) in existing:
+        return
+    try:
+        payload = json.loads(snapshot_path.read_text(encoding="utf-8"))
+    except (json.JSONDecodeError, OSError):
+        return
+    updates = payload.get("updates") if isinstance(payload, dict) else None
+    values = updates[0].get("values", []) if isinstance(updates, list) and updates else []
+    lat = lon = sog = cog = wind_speed = wind_angle = None
+    for item in values:
+        if not isinstance(item, dict):
+            continue
+        path, val = item.get("path"), item.get("value")
+        if path == "navigation.position" and isinstance(val, dict):
+            lat, lon = val.get("latitude"), val.get("longitude")
+        elif isinstance(val, (int, float)):
+            if path == "navigation.speedOverGround":
+                sog = float(val)
+            elif path == "navigation.courseOverGroundTrue":
+                cog = float(val)
+            elif path == "environment.wind.speedTrue":
+                wind_speed = float(val)
+            elif path == "environment.wind.angleTrue":
+                wind_angle = float(val)
+    if not isinstance(lat, (int, float)) or not isinstance(lon, (int, float)):
+        return
+    telemetry_archive.append_record(
+        output_dir, ts, lat, lon,
+        sog=sog, cog=cog, wind_speed=wind_speed, wind_angle=wind_angle,
+    )
+
 
 def _prune_old_position_files(output_dir: Path) -> None:
-    """Delete timestamped position snapshot files older than the retention window."""
+    """Retire snapshot files older than the retention window.
+
+    Retention is driven by retention_manifest.json, which records snapshot
+    filenames in insertion order (time order, by construction of
+    _format_position_filename), so each cycle pops expired entries off the
+    front in O(expired) instead of timestamp-parsing the whole telemetry
+    directory on every update. Retired snapshots are folded into the packed
+    daily archive when it does not already cover them, then deleted.
+    """
+    manifest_path = output_dir / Path(RETENTION_MANIFEST_FILE).name
+    had_manifest = manifest_path.exists()
+    files = _load_retention_manifest(output_dir)
     cutoff = datetime.now(UTC) - timedelta(hours=POSITION_RETENTION_HOURS)
-    for file_path in output_dir.iterdir():
-        if not file_path.is_file():
-            continue
-        ts = _parse_position_filename(file_path.name)
+    retired = 0
+    for name in files:
+        ts = _parse_position_filename(name)
         if ts is None:
+            retired += 1  # bogus entry — drop it from the manifest
             continue
-        if ts.replace(tzinfo=UTC) < cutoff:
-            file_path.unlink(missing_ok=True)
+        if ts.replace(tzinfo=UTC) >= cutoff:
+            break
+        snapshot_path = output_dir / name
+        if snapshot_path.exists():
+            _fold_snapshot_into_archive(output_dir, snapshot_path, ts.replace(tzinfo=UTC))
+            snapshot_path.unlink(missing_ok=True)
+        retired += 1
+    if retired or not had_manifest:
+        _write_retention_manifest(output_dir, files[retired:])
 
 
 # ── Per-day GPX track files ────────────────────────────────────────────────
@@ -475,6 +806,69 @@ def _extract_pos_from_values(
     return lat, lon, speed, course
 
 
+# Douglas-Peucker tolerances (degrees) for the multi-resolution track files.
+# ~0.01° ≈ 1 km — coarse enough for a whole-coast view; "fine" is close to
+# full resolution and is what the frontend renders at typical zoom levels.
+TRACK_LOD_TOLERANCES_DEG = {"coarse": 0.01, "medium": 0.002, "fine": 0.0005}
+
+
+def _perpendicular_distance_deg(point: dict[str, Any], start: dict[str, Any],
+                                end: dict[str, Any]) -> float:
+    """Distance (in degrees, planar approximation) from point to segment start-end."""
+    x0, y0 = point["longitude"], point["latitude"]
+    x1, y1 = start["longitude"], start["latitude"]
+    x2, y2 = end["longitude"], end["latitude"]
+    dx, dy = x2 - x1, y2 - y1
+    if dx == 0 and dy == 0:
+        return math.hypot(x0 - x1, y0 - y1)
+    t = max(0.0, min(1.0, ((x0 - x1) * dx + (y0 - y1) * dy) / (dx * dx + dy * dy)))
+    return math.hypot(x0 - (x1 + t * dx), y0 - (y1 + t * dy))
+
+
+def _simplify_points(points: list[dict[str, Any]], tolerance_deg: float) -> list[dict[str, Any]]:
+    """Douglas-Peucker line simplification, iterative to avoid deep recursion.
+
+    Keeps endpoints and every point further than tolerance_deg from the
+    simplified line. Input order is preserved.
+    """
+    if len(points) <= 2 or tolerance_deg <= 0:
+        return list(points)
+    keep = [False] * len(points)
+    keep[0] = keep[-1] = True
+    stack = [(0, len(points) - 1)]
+    while stack:
+        first, last = stack.pop()
+        max_dist = 0.0
+        max_idx = first
+        for i in range(first + 1, last):
+            dist = _perpendicular_distance_deg(points[i], points[first], points[last])
+            if dist > max_dist:
+                max_dist = dist
+                max_idx = i
+        if max_dist > tolerance_deg:
+            keep[max_idx] = True
+            stack.append((first, max_idx))
+            stack.append((max_idx, last))
+    return [p for p, k in zip(points, keep) if k]
+
+
+def _build_track_lod(points: list[dict[str, Any]], date_str: str) -> dict[str, Any]:
+    """Build the multi-resolution payload for one day's track.
+
+    Each level is a list of compact [lat, lon, timestamp, speed_ms, course_rad]
+    rows so the browser can draw a zoom-appropriate polyline without fetching
+    or parsing the full GPX.
+    """
+    levels: dict[str, list[list[Any]]] = {}
+    for name, tolerance in TRACK_LOD_TOLERANCES_DEG.items():
+        levels[name] = [
+            [round(p["latitude"], 6), round(p["longitude"], 6), p["timestamp"],
+             p.get("speed_ms"), p.get("course_rad")]
+            for p in _simplify_points(points, tolerance)
+        ]
+    return {"date": date_str, "full_points": len(points), "levels": levels}
+
+
 def _build_day_gpx(points: list[dict[str, Any]], date_str: str, vessel_name: str) -> str:
     """Serialise one sailing day's points to a GPX XML string (no XML declaration)."""
     g = ET.Element(f"{{{_NS_GPX}}}gpx", {"version": "1.1", "creator": vessel_name})
@@ -574,43 +968,38 @@ def _update_track_files(
 
     for date_str, points in by_day.items():
         gpx_path = tracks_dir / f"{date_str}.gpx"
+        lod_path = tracks_dir / f"{date_str}.lod.json"
         if gpx_path.exists() and date_str != today_utc:
-            existing.setdefault(date_str, _make_track_meta(date_str, points))
+            meta = existing.setdefault(date_str, _make_track_meta(date_str, points))
+            # Backfill the LOD file for days written before LODs existed.
+            if not lod_path.exists():
+                lod_path.write_text(json.dumps(_build_track_lod(points, date_str)),
+                                    encoding="utf-8")
+            meta.setdefault("lod", f"tracks/{lod_path.name}")
             continue
         gpx_xml = _build_day_gpx(points, date_str, vessel_name)
         gpx_path.write_text(f'<?xml version="1.0" encoding="UTF-8"?>\n{gpx_xml}\n', encoding="utf-8")
-        existing[date_str] = _make_track_meta(date_str, points)
+        lod_path.write_text(json.dumps(_build_track_lod(points, date_str)), encoding="utf-8")
+        meta = _make_track_meta(date_str, points)
+        meta["lod"] = f"tracks/{lod_path.name}"
+        existing[date_str] = meta
 
     _write_tracks_index(tracks_index_path, sorted(existing.values(), key=lambda t: t["date"]))
 
 
 def update_position_cache(blob: dict[str, Any], output_path: Path) -> None:
-    navigation = blob.get("navigation", {}) if isinstance(blob, dict) else {}
-    position = navigation.get("position") if isinstance(navigation, dict) else None
-    if not isinstance(position, dict):
-        return
-    value = position.get("value")
-    if not isinstance(value, dict):
-        return
-    lat = value.get("latitude")
-    lon = value.get("longitude")
-    if not isinstance(lat, (int, float)) or not isinstance(lon, (int, float)):
+    # One compiled walk produces everything this function needs: the snapshot
+    # values list, the flattened instrument readings, and the point fields.
+    extraction = BLOB_EXTRACTOR.extract(blob)
+    lat, lon = extraction.latitude, extraction.longitude
+    if lat is None or lon is None:
         return
 
-    timestamp = _parse_timestamp(position.get("timestamp")) or datetime.now(UTC)
-    speed_over_ground = None
-    course_over_ground_true = None
-    if isinstance(navigation, dict):
-        speed = navigation.get("speedOverGround")
-        if isinstance(speed, dict):
-            speed_value = speed.get("value")
-            if isinstance(speed_value, (int, float)):
-                speed_over_ground = speed_value
-        heading = navigation.get("headingTrue")
-        if isinstance(heading, dict):
-            heading_value = heading.get("value")
-            if isinstance(heading_value, (int, float)):
-                course_over_ground_true = heading_value
+    timestamp = _parse_timestamp(extraction.position_timestamp) or datetime.now(UTC)
+    speed_over_ground = extraction.speed_over_ground
+    # Historical quirk kept on purpose: the index's courseOverGroundTrue
+    # entry has always been fed from navigation.headingTrue.
+    course_over_ground_true = extraction.heading_true
     # Check privacy: use zone center if inside an exclusion zone.
     zone_center = _get_privacy_zone_center(lat, lon)
     if zone_center is not None:
@@ -623,10 +1012,10 @@ def update_position_cache(blob: dict[str, Any], output_path: Path) -> None:
     position_file = output_dir / filename
 
     # --- Snapshot file: full SignalK delta format, whitelisted paths only ---
-    signalk_values: list[dict[str, Any]] = []
-    _collect_signalk_values(blob, "", values=signalk_values, whitelist=SNAPSHOT_PATH_WHITELIST)
-    # Always strip any auto-collected navigation.position (may need replacing).
-    signalk_values = [v for v in signalk_values if v["path"] != "navigation.position"]
+    # Always strip the auto-collected navigation.position (may need replacing).
+    signalk_values = [
+        v for v in extraction.snapshot_values if v["path"] != "navigation.position"
+    ]
     display_lat, display_lon = zone_center if zone_center is not None else (lat, lon)
     pos_entry = {"path": "navigation.position", "value": {"latitude": display_lat, "longitude": display_lon}}
     signalk_values.insert(0, pos_entry)
@@ -642,6 +1031,7 @@ def update_position_cache(blob: dict[str, Any], output_path: Path) -> None:
 
     # Always update the all-snapshots index (no position data — privacy safe).
     _update_snapshot_index(output_dir, filename, timestamp)
+    _record_snapshot_for_retention(output_dir, filename)
 
     # --- Index entry: use zone center when inside a privacy zone ---
     display_lat, display_lon = zone_center if zone_center is not None else (lat, lon)
@@ -668,11 +1058,31 @@ def update_position_cache(blob: dict[str, Any], output_path: Path) -> None:
         entry_ts = _parse_timestamp(entry.get("timestamp"))
         return entry_ts is not None and entry_ts >= cutoff
 
-    entries = [entry for entry in entries if keep_entry(entry)]
+    kept: list[dict[str, Any]] = []
+    expired: list[dict[str, Any]] = []
+    for entry in entries:
+        (kept if keep_entry(entry) else expired).append(entry)
+    # Pruned entries are appended to monthly pages instead of being dropped.
+    _archive_position_entries(output_dir, expired)
+    entries = kept
     entries.append(index_entry)
     entries.sort(key=lambda item: item.get("timestamp") or "")
     _write_position_index(index_path, entries)
 
+    # --- Columnar archive: one packed binary file per UTC day ---
+    # Stores the same privacy-redacted values as the index so the browser can
+    # read a whole historical day with one fetch instead of N JSON requests.
+    telemetry_archive.append_record(
+        output_dir,
+        timestamp,
+        display_lat,
+        display_lon,
+        sog=speed_over_ground if zone_center is None else None,
+        cog=course_over_ground_true if zone_center is None else None,
+        wind_speed=extraction.wind_speed,
+        wind_angle=extraction.wind_angle,
+    )
+
     try:
         vessel_name = load_vessel_data().get("vessel_data", {}).get("name", "Vessel")
     except Exception:
@@ -684,10 +1094,42 @@ def update_position_cache(blob: dict[str, Any], output_path: Path) -> None:
         vessel_name,
     )
 
-    _update_instrument_log(output_dir, timestamp, blob)
+    _update_instrument_log(output_dir, timestamp, extraction.numeric_values)
+
+    # The rollup publishes aggregates only, so the true (unredacted) position
+    # is safe to fold here — zone centers would distort distances otherwise.
+    _update_voyage_stats(
+        output_dir, timestamp, lat, lon, speed_over_ground, extraction.engine_rpm
+    )
+
     _prune_old_position_files(output_dir)
 
 
+def _record_update_metrics(output_dir: Path, timings: dict[str, float]) -> None:
+    """Append one cycle's per-stage timings to a small rolling metrics file.
+
+    Keeps only the last UPDATE_METRICS_MAX_CYCLES cycles so a slow stage on
+    the Pi (a ballooning position cache, a crawling cellular push) shows up
+    in the committed data without the file itself growing unbounded.
+    """
+    metrics_path = output_dir / Path(UPDATE_METRICS_FILE).name
+    cycles: list[dict[str, Any]] = []
+    if metrics_path.exists():
+        try:
+            existing = json.loads(metrics_path.read_text(encoding="utf-8"))
+            if isinstance(existing, dict) and isinstance(existing.get("cycles"), list):
+                cycles = existing["cycles"]
+        except (json.JSONDecodeError, OSError):
+            print(f"Warning: could not parse {metrics_path}, starting metrics fresh")
+    entry: dict[str, Any] = {"timestamp": datetime.now(UTC).isoformat()}
+    for stage, seconds in timings.items():
+        entry[f"{stage}_ms"] = round(seconds * 1000.0, 1)
+    cycles.append(entry)
+    cycles = cycles[-UPDATE_METRICS_MAX_CYCLES:]
+    payload = {"updated": datetime.now(UTC).isoformat(), "cycles": cycles}
+    metrics_path.write_text(json.dumps(payload, separators=(",", ":")), encoding="utf-8")
+
+
 def run_update(
     branch: str,
     remote: str,
@@ -695,6 +1137,8 @@ def run_update(
     output_path: str,
     use_https: bool,
     no_push: bool,
+    defer_push: bool = False,
+    blob: dict[str, Any] | None = None,
 ) -> Path:
     # Modify SignalK URL if use_https is specified
     if use_https and signalk_url.startswith("http://"):
@@ -708,7 +1152,16 @@ def run_update(
 
     # Ensure destination directory exists
     output_file.parent.mkdir(parents=True, exist_ok=True)
-    blob = fetch_blob(signalk_url=signalk_url)
+    # Per-stage wall-clock timings for this cycle, recorded into the rolling
+    # metrics file below so slow stages on the Pi are visible after the fact.
+    timings: dict[str, float] = {}
+    cycle_start = time.perf_counter()
+    stage_start = cycle_start
+    # A caller-supplied blob (websocket daemon mode) skips the REST fetch.
+    if blob is None:
+        blob = fetch_blob(signalk_url=signalk_url)
+    blob = prune_blob_to_manifest(blob)
+    timings["fetch"] = time.perf_counter() - stage_start
 
     # Replace position with zone center in the blob if inside a privacy zone.
     nav = blob.get("navigation") if isinstance(blob, dict) else None
@@ -725,25 +1178,124 @@ def run_update(
                     pos_val["latitude"] = zone_center[0]
                     pos_val["longitude"] = zone_center[1]
 
+    stage_start = time.perf_counter()
     output_file.write_text(json.dumps(blob, indent=2), encoding="utf-8")
     print(f"Wrote SignalK blob to {output_file}")
+    timings["write"] = time.perf_counter() - stage_start
+    stage_start = time.perf_counter()
     update_position_cache(blob, output_file)
-    git_commit_and_push(no_push=no_push, remote=remote, branch=branch)
+    timings["cache"] = time.perf_counter() - stage_start
+    stage_start = time.perf_counter()
+    git_commit_and_push(no_push=no_push or defer_push, remote=remote, branch=branch)
+    timings["git"] = time.perf_counter() - stage_start
+    timings["total"] = time.perf_counter() - cycle_start
+    # Recorded after the commit, so each cycle's row rides along with the
+    # *next* cycle's push — a one-cycle lag nobody reading the file cares about.
+    try:
+        _record_update_metrics(output_file.parent, timings)
+    except OSError as exc:
+        print(f"Warning: could not record update metrics: {exc}")
+    if os.environ.get("LOG_STAGE_TIMINGS"):
+        summary = " ".join(f"{stage}={sec * 1000.0:.0f}ms" for stage, sec in timings.items())
+        print(f"Stage timings: {summary}")
     return output_file
 
 
 def main() -> int:
     try:
         args = parse_args()
+        # Batching: commit every cycle but amortize the (cellular-expensive)
+        # push across several snapshots. A large position change forces an
+        # immediate push so the map stays fresh while under way.
+        batching = args.batch_size > 1 or args.batch_minutes > 0
+        pending = 0
+        last_push_time = time.monotonic()
+        last_push_pos: tuple[float, float] | None = None
+
+        # Daemon mode: subscribe to the delta stream once and snapshot the
+        # in-memory state each cycle instead of re-fetching the whole tree.
+        delta_client = None
+        if args.websocket and args.interval > 0:
+            from .signalk_delta_client import SignalKDeltaClient
+
+            # Subscribe to every branch the committed blob keeps, not just the
+            # snapshot whitelist, so signalk_latest.json stays complete.
+            delta_client = SignalKDeltaClient(
+                args.signalk_url, frozenset(PATH_MANIFEST["blob_branches"])
+            )
+            delta_client.start()
+            if not delta_client.wait_connected(timeout=30):
+                print("SignalK stream not connected yet — falling back to REST this cycle")
+
         while True:
-            run_update(
+            blob = None
+            if delta_client is not None and delta_client.has_data():
+                # Stale leaves would otherwise linger in the in-memory state
+                # forever after a sensor goes quiet.
+                blob = filter_stale_data(delta_client.snapshot())
+            output_file = run_update(
                 branch=args.branch,
                 remote=args.remote,
                 signalk_url=args.signalk_url,
                 output_path=args.output,
                 use_https=args.use_https,
                 no_push=args.no_push,
+                defer_push=batching,
+                blob=blob,
             )
+            # Refresh the committed tide-prediction bundle when stale so
+            # viewers never need to hit the NOAA API themselves.
+            try:
+                position = _read_blob_position(output_file)
+                prefetch_tide_predictions.refresh_bundle_if_stale(
+                    get_project_root(),
+                    position[0] if position else None,
+                    position[1] if position else None,
+                )
+            except Exception as exc:  # noqa: BLE001 - tide bundle is best-effort
+                print(f"Tide bundle refresh failed: {exc}")
+            # Same idea for the Open-Meteo conditions forecast: fetch once
+            # per hour here, commit the bundle, and viewers read it from
+            # the site origin instead of the weather APIs.
+            try:
+                prefetch_forecast_bundle.refresh_bundle_if_stale(
+                    get_project_root(),
+                    position[0] if position else None,
+                    position[1] if position else None,
+                )
+            except Exception as exc:  # noqa: BLE001 - forecast bundle is best-effort
+                print(f"Forecast bundle refresh failed: {exc}")
+            # Resolve the location name once here instead of in every
+            # viewer's browser; cached by anchorage so repeats are free.
+            if position is not None:
+                try:
+                    reverse_geocode.update_location_file(
+                        get_project_root(), position[0], position[1]
+                    )
+                except Exception as exc:  # noqa: BLE001 - name is cosmetic
+                    print(f"Reverse geocode failed: {exc}")
+            if batching and not args.no_push:
+                pending += 1
+                position = _read_blob_position(output_file)
+                moved_m = (
+                    _haversine_m(*last_push_pos, *position)
+                    if last_push_pos is not None and position is not None
+                    else None
+                )
+                elapsed_minutes = (time.monotonic() - last_push_time) / 60
+                if args.interval == 0 or _should_flush_batch(
+                    pending,
+                    elapsed_minutes,
+                    moved_m,
+                    batch_size=args.batch_size,
+                    batch_minutes=args.batch_minutes,
+                    push_distance_m=args.push_distance_m,
+                ):
+                    git_push(remote=args.remote, branch=args.branch)
+                    pending = 0
+                    last_push_time = time.monotonic()
+                if position is not None and (pending == 0 or last_push_pos is None):
+                    last_push_pos = position
             if args.interval == 0:
                 break
             time.sleep(args.interval)
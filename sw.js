@@ -2,13 +2,38 @@
 //
 // Strategy:
 //   Static shell assets → cache-first (versioned cache; update on new deploy)
-//   Telemetry / data JSON → network-first, fall back to cache so the last
-//     known state is shown when the device is offline
+//   Telemetry / data JSON → stale-while-revalidate with a per-endpoint
+//     freshness budget; cached data paints immediately and the page gets a
+//     postMessage when a background revalidation lands something new
 //   CDN resources → stale-while-revalidate
 
-const SHELL_CACHE   = 'mermug-shell-v2';
+const SHELL_CACHE   = 'mermug-shell-v4';
 const DATA_CACHE    = 'mermug-data-v1';
 
+// How long a cached data response may be served without hitting the network.
+// First match wins; anything unmatched uses the default.
+const DATA_FRESHNESS = [
+  { pattern: /signalk_latest\.json$/,       maxAgeMs: 30 * 1000 },
+  { pattern: /positions_index\.json$/,      maxAgeMs: 30 * 1000 },
+  { pattern: /tide/,                        maxAgeMs: 60 * 60 * 1000 },
+  { pattern: /polars/,                      maxAgeMs: 24 * 60 * 60 * 1000 },
+];
+const DEFAULT_DATA_FRESHNESS_MS = 5 * 60 * 1000;
+
+// Endpoints refreshed by Background Sync so the cache is warm before the
+// user next opens the app.
+const WARM_DATA_PATHS = [
+  '/data/telemetry/signalk_latest.json',
+  '/data/telemetry/positions_index.json',
+  '/data/telemetry/tracks_index.json',
+  '/data/telemetry/instrument_log/manifest.json',
+];
+
+function dataFreshnessMs(pathname) {
+  const rule = DATA_FRESHNESS.find((r) => r.pattern.test(pathname));
+  return rule ? rule.maxAgeMs : DEFAULT_DATA_FRESHNESS_MS;
+}
+
 const SHELL_ASSETS = [
   '/',
   '/index.html',
@@ -17,6 +42,8 @@ const SHELL_ASSETS = [
   '/assets/utils.js',
   '/assets/constants.js',
   '/assets/app.js',
+  '/assets/track-worker.js',
+  '/assets/polar.js',
   '/data/vessel/info.yaml',
   '/data/vessel/logo.png',
   '/data/tide_stations.json',
@@ -61,9 +88,9 @@ self.addEventListener('fetch', (event) => {
   // Only intercept same-origin requests from here on.
   if (url.origin !== self.location.origin) return;
 
-  // Telemetry / data JSON — network-first with data-cache fallback
-  if (url.pathname.startsWith('/data/telemetry/')) {
-    event.respondWith(networkFirstWithCache(request, DATA_CACHE));
+  // Telemetry / data JSON — stale-while-revalidate within a freshness budget
+  if (url.pathname.startsWith('/data/telemetry/') || url.pathname.startsWith('/data/vessel/polars')) {
+    event.respondWith(staleWhileRevalidateData(event, request, url));
     return;
   }
 
@@ -88,22 +115,47 @@ async function cacheFirst(request, cacheName) {
   }
 }
 
-async function networkFirstWithCache(request, cacheName) {
-  try {
-    const response = await fetch(request);
-    if (response.ok) {
-      const cache = await caches.open(cacheName);
-      cache.put(request, response.clone());
+// Data SWR: serve the cached copy immediately (or straight away with no
+// network at all while it is within its freshness budget) and revalidate in
+// the background. When the revalidated body differs, every open window gets
+// a postMessage so the page re-renders exactly once.
+async function staleWhileRevalidateData(event, request, url) {
+  // Ignore cache-busting query strings so ?ts=… polls hit the same entry.
+  const cacheKey = url.origin + url.pathname;
+  const cache = await caches.open(DATA_CACHE);
+  const cached = await cache.match(cacheKey);
+
+  const revalidate = async () => {
+    try {
+      const response = await fetch(request);
+      if (response.ok) {
+        const prevBody = cached ? await cached.clone().text() : null;
+        const newBody = await response.clone().text();
+        await cache.put(cacheKey, response.clone());
+        if (prevBody !== null && prevBody !== newBody) {
+          const clients = await self.clients.matchAll({ type: 'window' });
+          clients.forEach((client) =>
+            client.postMessage({ type: 'data-revalidated', path: url.pathname }));
+        }
+      }
+      return response;
+    } catch {
+      return null;
     }
-    return response;
-  } catch {
-    const cached = await caches.match(request, { cacheName });
-    if (cached) return cached;
-    return new Response(JSON.stringify({ offline: true }), {
-      status: 503,
-      headers: { 'Content-Type': 'application/json' },
-    });
+  };
+
+  if (cached) {
+    const dateHeader = cached.headers.get('date');
+    const age = dateHeader ? Date.now() - new Date(dateHeader).getTime() : Infinity;
+    if (age >= dataFreshnessMs(url.pathname)) {
+      event.waitUntil(revalidate());
+    }
+    return cached;
   }
+  return (await revalidate()) ?? new Response(JSON.stringify({ offline: true }), {
+    status: 503,
+    headers: { 'Content-Type': 'application/json' },
+  });
 }
 
 async function staleWhileRevalidate(request, cacheName) {
@@ -116,3 +168,23 @@ async function staleWhileRevalidate(request, cacheName) {
   }).catch(() => null);
   return cached ?? (await fetchPromise) ?? new Response('Offline', { status: 503 });
 }
+
+// ── Background Sync: warm the data cache before the next visit ───────────────
+
+async function warmDataCache() {
+  const cache = await caches.open(DATA_CACHE);
+  await Promise.all(WARM_DATA_PATHS.map(async (path) => {
+    try {
+      const response = await fetch(path, { cache: 'no-cache' });
+      if (response.ok) await cache.put(self.location.origin + path, response.clone());
+    } catch { /* offline — next sync will try again */ }
+  }));
+}
+
+self.addEventListener('periodicsync', (event) => {
+  if (event.tag === 'refresh-data') event.waitUntil(warmDataCache());
+});
+
+self.addEventListener('sync', (event) => {
+  if (event.tag === 'refresh-data') event.waitUntil(warmDataCache());
+});
@@ -6,7 +6,11 @@ import { describe, expect, it } from 'vitest';
 
 const ROOT = resolve(dirname(fileURLToPath(import.meta.url)), '../..');
 const constantsSrc = readFileSync(`${ROOT}/assets/constants.js`, 'utf8');
-const appSrc = readFileSync(`${ROOT}/assets/app.js`, 'utf8');
+// polar.js is a lazily-loaded feature module split out of app.js; it shares
+// the same VESSEL_CONSTANTS global, so scan it for C.KEY references too.
+const appSrc = ['app.js', 'polar.js']
+  .map((f) => readFileSync(`${ROOT}/assets/${f}`, 'utf8'))
+  .join('\n');
 
 // vm.runInNewContext mirrors browser script scoping:
 //   var x = 1  → sandbox.x === 1   (same as window.x in a browser)
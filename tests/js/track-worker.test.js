@@ -0,0 +1,90 @@
+import { readFileSync } from 'fs';
+import vm from 'vm';
+import { resolve, dirname } from 'path';
+import { fileURLToPath } from 'url';
+import { beforeEach, describe, expect, it } from 'vitest';
+
+const ROOT = resolve(dirname(fileURLToPath(import.meta.url)), '../..');
+const workerSrc = readFileSync(`${ROOT}/assets/track-worker.js`, 'utf8');
+
+// Run the worker script against a stub `self` so we can post messages and
+// capture what it would send back to the page.
+function makeWorker() {
+  const posted = [];
+  const self = {
+    onmessage: null,
+    postMessage: (msg, _transfers) => posted.push(msg),
+  };
+  const sandbox = { self };
+  vm.runInNewContext(workerSrc, sandbox);
+  return { posted, send: (data) => self.onmessage({ data }) };
+}
+
+const GPX = `<?xml version="1.0" encoding="UTF-8"?>
+<gpx version="1.1" creator="Mermug">
+  <trk><trkseg>
+    <trkpt lat="37.800000" lon="-122.400000">
+      <time>2026-04-22T12:00:00Z</time>
+      <extensions><gpxtpx:TrackPointExtension>
+        <gpxtpx:speed>3.000</gpxtpx:speed>
+        <gpxtpx:course>90.0</gpxtpx:course>
+      </gpxtpx:TrackPointExtension></extensions>
+    </trkpt>
+    <trkpt lat="37.810000" lon="-122.410000">
+      <time>2026-04-22T12:05:00Z</time>
+    </trkpt>
+    <trkpt lat="bogus" lon="-122.4"><time>2026-04-22T12:06:00Z</time></trkpt>
+  </trkseg></trk>
+</gpx>`;
+
+describe('track-worker gpx parsing', () => {
+  let worker;
+  beforeEach(() => { worker = makeWorker(); });
+
+  it('extracts coordinates, times, speed, and course as typed arrays', () => {
+    worker.send({ id: 1, type: 'gpx', text: GPX });
+    expect(worker.posted).toHaveLength(1);
+    const result = worker.posted[0];
+    expect(result.id).toBe(1);
+    expect(result.lat).toHaveLength(2); // bogus trkpt dropped
+    expect(result.lat[0]).toBeCloseTo(37.8);
+    expect(result.lon[1]).toBeCloseTo(-122.41);
+    expect(result.ts[0]).toBe(Date.parse('2026-04-22T12:00:00Z'));
+    expect(result.sog[0]).toBeCloseTo(3.0);
+    expect(result.cog[0]).toBeCloseTo(Math.PI / 2); // degrees → radians
+    expect(Number.isNaN(result.sog[1])).toBe(true); // missing extension
+  });
+
+  it('drops results for cancelled jobs', () => {
+    worker.send({ type: 'cancel', id: 7 });
+    worker.send({ id: 7, type: 'gpx', text: GPX });
+    expect(worker.posted).toHaveLength(0);
+  });
+});
+
+describe('track-worker series building', () => {
+  it('builds sorted per-path columns from shard texts', () => {
+    const worker = makeWorker();
+    const shard = JSON.stringify({
+      entries: [
+        { timestamp: '2026-04-22T12:05:00Z', values: { 'navigation.speedOverGround': 3.0 } },
+        { timestamp: '2026-04-22T12:00:00Z', values: { 'navigation.speedOverGround': 2.0, bad: 'x' } },
+      ],
+    });
+    worker.send({ id: 2, type: 'series', texts: ['not json', shard], limit: 60 });
+    const result = worker.posted[0];
+    expect(result.paths).toEqual(['navigation.speedOverGround']);
+    expect(Array.from(result.values[0])).toEqual([2, 3]); // sorted by time
+    expect(result.times[0][0]).toBeLessThan(result.times[0][1]);
+  });
+
+  it('applies the entry limit to the newest entries', () => {
+    const worker = makeWorker();
+    const entries = Array.from({ length: 5 }, (_, i) => ({
+      timestamp: `2026-04-22T12:0${i}:00Z`,
+      values: { v: i },
+    }));
+    worker.send({ id: 3, type: 'series', texts: [JSON.stringify({ entries })], limit: 2 });
+    expect(Array.from(worker.posted[0].values[0])).toEqual([3, 4]);
+  });
+});
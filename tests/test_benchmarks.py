@@ -0,0 +1,162 @@
+"""Performance regression benchmarks for the ingestion hot paths.
+
+Run via `make benchmark` (pytest-benchmark must be installed; the cases
+skip cleanly when it is not, so the normal `make test` run is unaffected).
+Each case also asserts a generous absolute ceiling — roughly 5× what a
+Raspberry Pi 4 measures — so a change that doubles a hot path fails loudly
+while normal machine-to-machine variance does not.
+"""
+from __future__ import annotations
+
+import importlib.util
+import json
+import re
+from datetime import UTC, datetime, timedelta
+from pathlib import Path
+
+import pytest
+
+import scripts.backfill_tracks as bft
+import scripts.update_signalk_data as usd
+
+# Timing cases need the pytest-benchmark plugin; the page-weight budget at the
+# bottom is plain assertions and runs with the normal suite regardless.
+_HAS_BENCHMARK = importlib.util.find_spec("pytest_benchmark") is not None
+needs_benchmark = pytest.mark.skipif(
+    not _HAS_BENCHMARK, reason="pytest-benchmark not installed"
+)
+
+SNAPSHOT_COUNT = 1000
+
+# Mean-time ceilings (seconds). Generous on purpose: they should only trip
+# on algorithmic regressions, not on a busy CI runner.
+BUDGET_FILTER_STALE_S = 0.05
+BUDGET_PARSE_SNAPSHOTS_S = 2.0
+BUDGET_UPDATE_TRACKS_S = 5.0
+
+
+def _snapshot_payload(i: int, timestamp: datetime) -> dict:
+    """One update-cycle snapshot, shaped like update_position_cache writes."""
+    return {
+        "context": "vessels.self",
+        "updates": [{
+            "timestamp": timestamp.isoformat(),
+            "values": [
+                {"path": "navigation.position",
+                 "value": {"latitude": 37.8 + i * 1e-4, "longitude": -122.4 + i * 1e-4}},
+                {"path": "navigation.speedOverGround", "value": 2.5 + (i % 10) * 0.1},
+                {"path": "navigation.courseOverGroundTrue", "value": (i % 360) * 3.14159 / 180},
+                {"path": "environment.wind.speedTrue.value", "value": 6.0},
+            ],
+        }],
+    }
+
+
+@pytest.fixture(scope="module")
+def snapshot_files(tmp_path_factory):
+    """1,000 deterministic snapshot files, one per update cycle."""
+    root = tmp_path_factory.mktemp("snapshots")
+    start = datetime(2026, 5, 1, tzinfo=UTC)
+    paths = []
+    for i in range(SNAPSHOT_COUNT):
+        ts = start + timedelta(minutes=5 * i)
+        path = root / f"signalk_{ts.strftime('%Y-%m-%dT%H%M%S')}.json"
+        path.write_text(json.dumps(_snapshot_payload(i, ts)))
+        paths.append(path)
+    return paths
+
+
+@pytest.fixture(scope="module")
+def position_entries():
+    start = datetime(2026, 5, 1, tzinfo=UTC)
+    entries = []
+    for i in range(SNAPSHOT_COUNT):
+        ts = start + timedelta(minutes=5 * i)
+        entries.append({
+            "timestamp": ts.isoformat(),
+            "file": f"signalk_{i}.json",
+            "values": [
+                {"path": "navigation.position",
+                 "value": {"latitude": 37.8 + i * 1e-4, "longitude": -122.4 + i * 1e-4}},
+                {"path": "navigation.speedOverGround", "value": 2.5},
+            ],
+        })
+    return entries
+
+
+def _wide_blob(branches: int = 40, leaves: int = 25) -> dict:
+    now = datetime.now(UTC).isoformat()
+    return {
+        f"branch{b}": {
+            f"leaf{n}": {"value": n, "timestamp": now, "meta": {"units": "m"}}
+            for n in range(leaves)
+        }
+        for b in range(branches)
+    }
+
+
+@needs_benchmark
+def test_benchmark_filter_stale_data(benchmark):
+    blob = _wide_blob()
+    result = benchmark(lambda: usd.filter_stale_data(json.loads(json.dumps(blob))))
+    assert result  # sanity: fresh values survive
+    assert benchmark.stats.stats.mean < BUDGET_FILTER_STALE_S
+
+
+@needs_benchmark
+def test_benchmark_parse_snapshots(benchmark, snapshot_files):
+    def parse_all():
+        return [bft._parse_snapshot(p) for p in snapshot_files]
+
+    points = benchmark(parse_all)
+    assert all(pt is not None for pt in points)
+    assert benchmark.stats.stats.mean < BUDGET_PARSE_SNAPSHOTS_S
+
+
+@needs_benchmark
+def test_benchmark_update_track_files(benchmark, position_entries, tmp_path):
+    counter = iter(range(10_000))
+
+    def update(entries=position_entries):
+        run_dir = tmp_path / f"run{next(counter)}"
+        usd._update_track_files(entries, run_dir / "tracks",
+                                run_dir / "tracks_index.json", "Benchmark")
+
+    benchmark.pedantic(update, rounds=3, iterations=1)
+    assert benchmark.stats.stats.mean < BUDGET_UPDATE_TRACKS_S
+
+
+# ── Frontend page-weight budget ──────────────────────────────────────────────
+# Not a timing benchmark: a plain assertion on the bytes a first paint costs,
+# so it runs with the normal suite too.
+
+ROOT = Path(__file__).resolve().parent.parent
+
+# Uncompressed bytes of index.html plus every local render-blocking asset.
+PAGE_WEIGHT_BUDGET_BYTES = 300_000
+APP_JS_BUDGET_BYTES = 250_000
+
+
+def _critical_local_assets() -> list[Path]:
+    html = (ROOT / "index.html").read_text(encoding="utf-8")
+    scripts = re.findall(r'<script src="(assets/[^"?]+)', html)
+    styles = re.findall(r'<link rel="stylesheet" href="(assets/[^"?]+)', html)
+    return [ROOT / src for src in scripts + styles]
+
+
+def test_page_weight_budget():
+    assets = _critical_local_assets()
+    assert assets, "no local assets found in index.html"
+    total = (ROOT / "index.html").stat().st_size + sum(p.stat().st_size for p in assets)
+    assert total < PAGE_WEIGHT_BUDGET_BYTES, (
+        f"critical-path page weight {total} bytes exceeds {PAGE_WEIGHT_BUDGET_BYTES}"
+    )
+    assert (ROOT / "assets/app.js").stat().st_size < APP_JS_BUDGET_BYTES
+
+
+def test_lazy_modules_stay_off_the_critical_path():
+    html = (ROOT / "index.html").read_text(encoding="utf-8")
+    # polar.js is injected on scroll and track-worker.js from the worker RPC;
+    # a static script tag would put them back in the first-paint budget.
+    assert "assets/polar.js" not in re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    assert "assets/track-worker.js" not in html
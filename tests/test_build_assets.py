@@ -0,0 +1,89 @@
+"""Tests for the content-hashed dist/ build."""
+from __future__ import annotations
+
+import json
+
+import scripts.build_assets as ba
+
+
+def _make_site(root):
+    assets = root / "assets"
+    assets.mkdir(parents=True)
+    (assets / "styles.css").write_text("body { color: navy; }")
+    (assets / "constants.js").write_text("var VESSEL_CONSTANTS = {};")
+    (assets / "utils.js").write_text("function haversine() {}")
+    (assets / "track-worker.js").write_text("self.onmessage = () => {};")
+    (assets / "polar.js").write_text("function loadPolarData() {}")
+    (assets / "app.js").write_text(
+        "loadFeatureScript('assets/polar.js?v=3');\n"
+        "new Worker('assets/track-worker.js');\n"
+    )
+    (assets / "favicon.ico").write_bytes(b"icon")
+    (root / "index.html").write_text(
+        "<html><head>\n"
+        '<link rel="preload" href="assets/app.js?v=3" as="script" />\n'
+        '<link rel="stylesheet" href="assets/styles.css" />\n'
+        "</head><body>\n"
+        '<script src="assets/app.js?v=3"></script>\n'
+        "</body></html>\n"
+    )
+    (root / "sw.js").write_text(
+        "const SHELL_CACHE   = 'mermug-shell-v4';\n"
+        "const SHELL_ASSETS = ['/assets/app.js', '/assets/styles.css'];\n"
+    )
+    (root / "manifest.json").write_text("{}")
+    (root / "data").mkdir()
+    (root / "data" / "tide_stations.json").write_text("{}")
+    return root
+
+
+def test_build_hashes_and_rewrites_references(tmp_path):
+    root = _make_site(tmp_path / "site")
+    dist = tmp_path / "dist"
+    mapping = ba.build(root, dist)
+
+    for original, hashed in mapping.items():
+        assert (dist / hashed).exists()
+        assert hashed != original
+
+    html = (dist / "index.html").read_text()
+    assert mapping["assets/app.js"] in html
+    assert "app.js?v=3" not in html
+    assert mapping["assets/styles.css"] in html
+
+    app_js = (dist / mapping["assets/app.js"]).read_text()
+    assert mapping["assets/polar.js"] in app_js
+    assert mapping["assets/track-worker.js"] in app_js
+
+    sw = (dist / "sw.js").read_text()
+    assert mapping["assets/app.js"] in sw
+    assert "mermug-shell-v4" not in sw  # cache name now follows bundle hash
+
+
+def test_build_injects_first_fetch_preload(tmp_path):
+    root = _make_site(tmp_path / "site")
+    dist = tmp_path / "dist"
+    ba.build(root, dist)
+    head = (dist / "index.html").read_text().split("</head>")[0]
+    assert "data/telemetry/signalk_latest.json" in head
+    assert 'as="fetch"' in head
+
+
+def test_build_links_data_and_copies_plain_assets(tmp_path):
+    root = _make_site(tmp_path / "site")
+    dist = tmp_path / "dist"
+    ba.build(root, dist)
+    assert (dist / "data").is_symlink()
+    assert (dist / "data" / "tide_stations.json").exists()
+    assert (dist / "assets" / "favicon.ico").read_bytes() == b"icon"
+    assert json.loads((dist / "manifest.json").read_text()) == {}
+
+
+def test_unchanged_assets_keep_their_hash_across_builds(tmp_path):
+    root = _make_site(tmp_path / "site")
+    first = ba.build(root, tmp_path / "dist1")
+    (root / "assets" / "styles.css").write_text("body { color: teal; }")
+    second = ba.build(root, tmp_path / "dist2")
+    assert first["assets/styles.css"] != second["assets/styles.css"]
+    # utils.js content did not change, so repeat visitors keep the cache hit.
+    assert first["assets/utils.js"] == second["assets/utils.js"]
@@ -0,0 +1,92 @@
+"""Tests for the tide station grid-bucket index builder."""
+from __future__ import annotations
+
+import json
+import math
+
+import scripts.build_tide_station_index as bts
+
+
+def test_grid_key_floors_toward_negative():
+    # Floor (not truncate) so western longitudes bucket consistently.
+    assert bts.grid_key(37.8, -122.4) == "37:-123"
+    assert bts.grid_key(-33.9, 151.2) == "-34:151"
+
+
+def test_build_grid_buckets_by_cell():
+    stations = [
+        {"id": "a", "lat": 37.8, "lon": -122.4},
+        {"id": "b", "lat": 37.2, "lon": -122.9},  # same cell as "a"
+        {"id": "c", "lat": 32.9, "lon": -117.3},
+        {"id": "d", "lat": None, "lon": -117.3},  # malformed — skipped
+    ]
+    grid = bts.build_grid(stations)
+    assert grid["cell_deg"] == bts.GRID_CELL_DEG
+    assert grid["cells"]["37:-123"] == [0, 1]
+    assert grid["cells"]["32:-118"] == [2]
+    assert sum(len(v) for v in grid["cells"].values()) == 3
+
+
+def test_rebuild_index_preserves_stations(tmp_path):
+    path = tmp_path / "tide_stations.json"
+    stations = [{"id": "9414290", "name": "San Francisco", "lat": 37.806, "lon": -122.465}]
+    path.write_text(json.dumps({"stations": stations}))
+    cell_count = bts.rebuild_index(path)
+    assert cell_count == 1
+    data = json.loads(path.read_text())
+    assert data["stations"] == stations
+    assert data["grid"]["cells"][bts.grid_key(37.806, -122.465)] == [0]
+
+
+def test_rebuild_index_keeps_station_lines_verbatim(tmp_path):
+    # The real file is hand-kept one station per line; a rebuild must not
+    # reformat it — only the grid line should change between runs.
+    path = tmp_path / "tide_stations.json"
+    station_line = '      { "id": "9410660", "name": "Los Angeles", "lat": 33.720, "lon": -118.272 }'
+    path.write_text("{\n" + '  "stations": [\n' + station_line + "\n  ]\n}\n")
+    bts.rebuild_index(path)
+    text = path.read_text()
+    assert station_line in text
+    assert '  "grid": {"cell_deg"' in text  # single compact line, no indent churn
+    before = text
+    bts.rebuild_index(path)
+    assert path.read_text() == before
+
+
+def test_grid_probe_agrees_with_linear_scan(tmp_path):
+    """Mirror the frontend ring probe and check it against brute force."""
+    stations = [
+        {"id": str(i), "lat": 32.0 + (i * 7 % 17) * 0.9, "lon": -125.0 + (i * 5 % 13) * 1.1}
+        for i in range(40)
+    ]
+    grid = bts.build_grid(stations)
+
+    def haversine(lat1, lon1, lat2, lon2):
+        phi1, phi2 = math.radians(lat1), math.radians(lat2)
+        a = (math.sin(math.radians(lat2 - lat1) / 2) ** 2
+             + math.cos(phi1) * math.cos(phi2) * math.sin(math.radians(lon2 - lon1) / 2) ** 2)
+        return 2 * 6_371_000 * math.asin(math.sqrt(a))
+
+    def probe(lat, lon):
+        cell = grid["cell_deg"]
+        lat_idx, lon_idx = math.floor(lat / cell), math.floor(lon / cell)
+        best, best_dist, found_ring = None, math.inf, -1
+        for ring in range(0, 400):
+            if found_ring >= 0 and ring > found_ring + 1:
+                break
+            for di in range(-ring, ring + 1):
+                for dj in range(-ring, ring + 1):
+                    if max(abs(di), abs(dj)) != ring:
+                        continue
+                    for idx in grid["cells"].get(f"{lat_idx + di}:{lon_idx + dj}", []):
+                        s = stations[idx]
+                        d = haversine(lat, lon, s["lat"], s["lon"])
+                        if d < best_dist:
+                            best, best_dist = s, d
+            if best is not None and found_ring < 0:
+                found_ring = ring
+        return best
+
+    for lat, lon in [(37.8, -122.4), (33.0, -117.5), (45.5, -124.0), (30.1, -110.0)]:
+        linear = min(stations, key=lambda s: haversine(lat, lon, s["lat"], s["lon"]))
+        assert probe(lat, lon)["id"] == linear["id"]
@@ -0,0 +1,81 @@
+"""Tests for the telemetry history compaction job, using real throwaway repos."""
+from __future__ import annotations
+
+import subprocess
+from datetime import UTC, datetime, timedelta
+
+import scripts.compact_data_history as cdh
+
+
+def _git(repo, *args, env_date=None):
+    env = None
+    if env_date is not None:
+        import os
+        env = dict(os.environ)
+        env["GIT_AUTHOR_DATE"] = env_date
+        env["GIT_COMMITTER_DATE"] = env_date
+    return subprocess.run(
+        ["git", *args], cwd=repo, env=env,
+        capture_output=True, text=True, check=True,
+    ).stdout.strip()
+
+
+def _make_repo(tmp_path, commit_ages_days):
+    """Init a repo with one commit per age (oldest first), on branch data."""
+    repo = tmp_path / "repo"
+    repo.mkdir()
+    _git(repo, "init", "-q", "-b", "data")
+    _git(repo, "config", "user.email", "pi@example.com")
+    _git(repo, "config", "user.name", "pi")
+    now = datetime.now(UTC)
+    for i, age in enumerate(commit_ages_days):
+        (repo / f"snapshot_{i}.json").write_text(f'{{"n": {i}}}')
+        _git(repo, "add", ".")
+        date = (now - timedelta(days=age)).isoformat()
+        _git(repo, "commit", "-q", "-m", f"Auto update {i}", env_date=date)
+    return repo
+
+
+def test_find_oldest_retained_commit(tmp_path):
+    repo = _make_repo(tmp_path, [100, 50, 10, 1])
+    cutoff = datetime.now(UTC) - timedelta(days=30)
+    boundary = cdh.find_oldest_retained_commit("data", cutoff, cwd=repo)
+    assert _git(repo, "log", "-1", "--format=%s", boundary) == "Auto update 2"
+
+
+def test_find_oldest_retained_commit_none_in_window(tmp_path):
+    repo = _make_repo(tmp_path, [100, 90])
+    cutoff = datetime.now(UTC) - timedelta(days=30)
+    assert cdh.find_oldest_retained_commit("data", cutoff, cwd=repo) is None
+
+
+def test_squash_preserves_tree_and_shortens_history(tmp_path):
+    repo = _make_repo(tmp_path, [100, 50, 10, 1])
+    cutoff = datetime.now(UTC) - timedelta(days=30)
+    boundary = cdh.find_oldest_retained_commit("data", cutoff, cwd=repo)
+    tree_before = _git(repo, "rev-parse", "data^{tree}")
+
+    assert cdh.squash_history_before(boundary, "data", cwd=repo) is True
+
+    # Same final tree, but the two old commits collapsed into one baseline.
+    assert _git(repo, "rev-parse", "data^{tree}") == tree_before
+    subjects = _git(repo, "log", "--format=%s", "data").splitlines()
+    assert len(subjects) == 3
+    assert subjects[-1].startswith("Telemetry baseline through")
+    assert subjects[0] == "Auto update 3"
+
+
+def test_squash_noop_when_history_already_compact(tmp_path):
+    repo = _make_repo(tmp_path, [10, 1])
+    cutoff = datetime.now(UTC) - timedelta(days=30)
+    boundary = cdh.find_oldest_retained_commit("data", cutoff, cwd=repo)
+    assert boundary is not None
+    # Everything is inside the window — boundary is the root commit.
+    assert cdh.squash_history_before(boundary, "data", cwd=repo) is False
+
+
+def test_working_tree_is_clean(tmp_path):
+    repo = _make_repo(tmp_path, [1])
+    assert cdh.working_tree_is_clean(cwd=repo) is True
+    (repo / "dirty.txt").write_text("x")
+    assert cdh.working_tree_is_clean(cwd=repo) is False
@@ -4,6 +4,7 @@ from __future__ import annotations
 import json
 import math
 import xml.etree.ElementTree as ET
+from contextlib import ExitStack
 from datetime import UTC, datetime
 from pathlib import Path
 from unittest.mock import patch
@@ -487,3 +488,137 @@ def test_backfill_main_does_not_overwrite_existing_gpx(tmp_path):
         bt.main()
 
     assert (tracks_dir / "2026-03-21.gpx").read_text() == sentinel
+
+
+# ---------------------------------------------------------------------------
+# backfill_tracks high-water mark
+# ---------------------------------------------------------------------------
+
+def _backfill_patches(tel_dir, tracks_dir, tmp_path):
+    return (
+        patch("scripts.backfill_tracks.TELEMETRY_DIR", tel_dir),
+        patch("scripts.backfill_tracks.TRACKS_DIR", tracks_dir),
+        patch("scripts.backfill_tracks.TRACKS_INDEX_FILE", tel_dir / "tracks_index.json"),
+        patch("scripts.backfill_tracks.load_vessel_info", return_value={"name": "S.V. Test"}),
+        patch("scripts.backfill_tracks.get_project_root", return_value=tmp_path),
+    )
+
+
+def test_backfill_saves_high_water_mark(tmp_path):
+    tel_dir = tmp_path / "telemetry"
+    tel_dir.mkdir()
+    last = _make_snapshot_file(tel_dir, "2026-03-21T16:00:00+00:00", OUTSIDE_LAT, OUTSIDE_LON)
+    _make_snapshot_file(tel_dir, "2026-03-21T14:00:00+00:00", OUTSIDE_LAT, OUTSIDE_LON)
+
+    with ExitStack() as stack:
+        for p in _backfill_patches(tel_dir, tel_dir / "tracks", tmp_path):
+            stack.enter_context(p)
+        bt.main()
+
+    state = json.loads((tel_dir / "backfill_state.json").read_text())
+    assert state["last_processed"] == last.name
+
+
+def test_backfill_skips_snapshots_below_high_water_mark(tmp_path):
+    tel_dir = tmp_path / "telemetry"
+    tel_dir.mkdir()
+    old = _make_snapshot_file(tel_dir, "2026-03-21T14:00:00+00:00", OUTSIDE_LAT, OUTSIDE_LON)
+    _make_snapshot_file(tel_dir, "2026-03-22T14:00:00+00:00", OUTSIDE_LAT, OUTSIDE_LON)
+    bt._save_high_water_mark(tel_dir / "backfill_state.json", old.name)
+    tracks_dir = tel_dir / "tracks"
+
+    with ExitStack() as stack:
+        for p in _backfill_patches(tel_dir, tracks_dir, tmp_path):
+            stack.enter_context(p)
+        bt.main()
+
+    # Only the newer day should have been parsed and written
+    assert not (tracks_dir / "2026-03-21.gpx").exists()
+    assert (tracks_dir / "2026-03-22.gpx").exists()
+
+
+def test_backfill_full_flag_ignores_high_water_mark(tmp_path):
+    tel_dir = tmp_path / "telemetry"
+    tel_dir.mkdir()
+    old = _make_snapshot_file(tel_dir, "2026-03-21T14:00:00+00:00", OUTSIDE_LAT, OUTSIDE_LON)
+    bt._save_high_water_mark(tel_dir / "backfill_state.json", old.name)
+    tracks_dir = tel_dir / "tracks"
+
+    with ExitStack() as stack:
+        for p in _backfill_patches(tel_dir, tracks_dir, tmp_path):
+            stack.enter_context(p)
+        bt.main(["--full"])
+
+    assert (tracks_dir / "2026-03-21.gpx").exists()
+
+
+def test_load_high_water_mark_corrupt_file(tmp_path):
+    state = tmp_path / "backfill_state.json"
+    state.write_text("not json")
+    assert bt._load_high_water_mark(state) is None
+
+
+# ---------------------------------------------------------------------------
+# Track level-of-detail (Douglas-Peucker)
+# ---------------------------------------------------------------------------
+
+def _pt(lat: float, lon: float, ts: str = "2026-04-11T12:00:00+00:00") -> dict:
+    return {"timestamp": ts, "latitude": lat, "longitude": lon,
+            "speed_ms": 2.0, "course_rad": 1.0}
+
+
+def test_simplify_drops_collinear_points():
+    points = [_pt(37.0, -122.0), _pt(37.0, -121.9), _pt(37.0, -121.8)]
+    simplified = usd._simplify_points(points, 0.001)
+    assert simplified == [points[0], points[2]]
+
+
+def test_simplify_keeps_significant_deviation():
+    points = [_pt(37.0, -122.0), _pt(37.5, -121.9), _pt(37.0, -121.8)]
+    simplified = usd._simplify_points(points, 0.001)
+    assert len(simplified) == 3
+
+
+def test_simplify_keeps_endpoints_and_order():
+    points = [_pt(37.0 + i * 0.001, -122.0 + (i % 2) * 0.0001) for i in range(20)]
+    simplified = usd._simplify_points(points, 0.01)
+    assert simplified[0] == points[0]
+    assert simplified[-1] == points[-1]
+
+
+def test_simplify_coarser_tolerance_keeps_fewer_points():
+    points = [_pt(37.0 + i * 0.01, -122.0 + math.sin(i) * 0.005) for i in range(50)]
+    fine = usd._simplify_points(points, usd.TRACK_LOD_TOLERANCES_DEG["fine"])
+    coarse = usd._simplify_points(points, usd.TRACK_LOD_TOLERANCES_DEG["coarse"])
+    assert len(coarse) <= len(fine) <= len(points)
+
+
+def test_build_track_lod_levels_and_row_shape():
+    points = [_pt(37.0 + i * 0.01, -122.0 + math.sin(i) * 0.005,
+                  ts=f"2026-04-11T12:{i:02d}:00+00:00") for i in range(30)]
+    lod = usd._build_track_lod(points, "2026-04-11")
+    assert lod["date"] == "2026-04-11"
+    assert lod["full_points"] == 30
+    assert set(lod["levels"]) == set(usd.TRACK_LOD_TOLERANCES_DEG)
+    row = lod["levels"]["fine"][0]
+    assert row == [37.0, -122.0, "2026-04-11T12:00:00+00:00", 2.0, 1.0]
+
+
+def test_update_track_files_writes_lod(tmp_path):
+    entries = _make_outside_entries("2026-04-11")
+    tracks_dir = tmp_path / "tracks"
+    index_path = tmp_path / "tracks_index.json"
+
+    with patch("scripts.update_signalk_data.datetime") as mock_dt:
+        mock_dt.now.return_value = datetime(2026, 4, 20, 12, 0, tzinfo=UTC)
+        mock_dt.fromisoformat = datetime.fromisoformat
+        usd._update_track_files(entries, tracks_dir, index_path, "S.V. Test")
+
+    lod_path = tracks_dir / "2026-04-11.lod.json"
+    assert lod_path.exists()
+    lod = json.loads(lod_path.read_text())
+    assert set(lod["levels"]) == set(usd.TRACK_LOD_TOLERANCES_DEG)
+
+    index = json.loads(index_path.read_text())
+    entry = next(t for t in index["tracks"] if t["date"] == "2026-04-11")
+    assert entry["lod"] == "tracks/2026-04-11.lod.json"
@@ -0,0 +1,124 @@
+"""Tests for the Pi-side Open-Meteo forecast bundle."""
+from __future__ import annotations
+
+import json
+from datetime import UTC, datetime, timedelta
+from unittest.mock import patch
+
+import scripts.prefetch_forecast_bundle as pfb
+
+
+class _FakeResp:
+    def __init__(self, payload):
+        self._payload = payload
+
+    def raise_for_status(self):
+        pass
+
+    def json(self):
+        return self._payload
+
+
+def _fake_requests(payload_by_url):
+    class FakeRequests:
+        class RequestException(Exception):
+            pass
+
+        @staticmethod
+        def get(url, params=None, timeout=30):
+            payload = payload_by_url.get(url)
+            if payload is None:
+                raise FakeRequests.RequestException(f"no route for {url}")
+            return _FakeResp(payload)
+
+    return FakeRequests
+
+
+_HOURLY_PAYLOAD = {"hourly": {"time": ["2026-08-26T00:00"], "wind_speed_10m": [12.5]}}
+
+
+def test_build_bundle_includes_both_sources():
+    fake = _fake_requests({
+        pfb.ATMOS_API_URL: _HOURLY_PAYLOAD,
+        pfb.MARINE_API_URL: _HOURLY_PAYLOAD,
+    })
+    with patch("scripts.prefetch_forecast_bundle.requests", fake):
+        bundle = pfb.build_bundle(37.8, -122.4)
+    assert bundle["atmos"]["hourly"]["wind_speed_10m"] == [12.5]
+    assert "marine" in bundle
+    assert bundle["latitude"] == 37.8
+
+
+def test_build_bundle_survives_one_failed_source():
+    fake = _fake_requests({pfb.ATMOS_API_URL: _HOURLY_PAYLOAD})
+    with patch("scripts.prefetch_forecast_bundle.requests", fake):
+        bundle = pfb.build_bundle(37.8, -122.4)
+    assert "atmos" in bundle
+    assert "marine" not in bundle
+
+
+def _write_bundle(path, generated, lat=37.8, lon=-122.4):
+    path.write_text(json.dumps({
+        "generated": generated.isoformat(),
+        "latitude": lat,
+        "longitude": lon,
+        "atmos": _HOURLY_PAYLOAD,
+    }))
+
+
+def test_bundle_is_fresh_recent_and_nearby(tmp_path):
+    path = tmp_path / "forecast_bundle.json"
+    _write_bundle(path, datetime.now(UTC) - timedelta(minutes=10))
+    assert pfb.bundle_is_fresh(path, 37.8, -122.4) is True
+
+
+def test_bundle_is_stale_when_old(tmp_path):
+    path = tmp_path / "forecast_bundle.json"
+    _write_bundle(path, datetime.now(UTC) - timedelta(hours=2))
+    assert pfb.bundle_is_fresh(path, 37.8, -122.4) is False
+
+
+def test_bundle_is_stale_when_vessel_moved(tmp_path):
+    path = tmp_path / "forecast_bundle.json"
+    _write_bundle(path, datetime.now(UTC) - timedelta(minutes=10))
+    # Half Moon Bay is well over 25 km from the bundled position.
+    assert pfb.bundle_is_fresh(path, 37.47, -122.44) is False
+
+
+def test_bundle_is_stale_when_missing_or_corrupt(tmp_path):
+    path = tmp_path / "forecast_bundle.json"
+    assert pfb.bundle_is_fresh(path, 37.8, -122.4) is False
+    path.write_text("{not json")
+    assert pfb.bundle_is_fresh(path, 37.8, -122.4) is False
+
+
+def test_refresh_skips_fresh_bundle(tmp_path):
+    bundle_path = tmp_path / pfb.FORECAST_BUNDLE_FILE
+    bundle_path.parent.mkdir(parents=True)
+    _write_bundle(bundle_path, datetime.now(UTC) - timedelta(minutes=5))
+    fake = _fake_requests({})  # any fetch would raise
+    with patch("scripts.prefetch_forecast_bundle.requests", fake):
+        assert pfb.refresh_bundle_if_stale(tmp_path, 37.8, -122.4) is None
+
+
+def test_refresh_writes_bundle(tmp_path):
+    fake = _fake_requests({
+        pfb.ATMOS_API_URL: _HOURLY_PAYLOAD,
+        pfb.MARINE_API_URL: _HOURLY_PAYLOAD,
+    })
+    with patch("scripts.prefetch_forecast_bundle.requests", fake):
+        path = pfb.refresh_bundle_if_stale(tmp_path, 37.8, -122.4)
+    assert path is not None
+    bundle = json.loads(path.read_text())
+    assert "atmos" in bundle and "marine" in bundle
+
+
+def test_refresh_keeps_previous_when_all_fetches_fail(tmp_path):
+    bundle_path = tmp_path / pfb.FORECAST_BUNDLE_FILE
+    bundle_path.parent.mkdir(parents=True)
+    _write_bundle(bundle_path, datetime.now(UTC) - timedelta(hours=3))
+    before = bundle_path.read_text()
+    fake = _fake_requests({})
+    with patch("scripts.prefetch_forecast_bundle.requests", fake):
+        assert pfb.refresh_bundle_if_stale(tmp_path, 37.8, -122.4) is None
+    assert bundle_path.read_text() == before
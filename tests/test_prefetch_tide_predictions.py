@@ -0,0 +1,88 @@
+"""Tests for the Pi-side NOAA tide prediction bundler."""
+from __future__ import annotations
+
+import json
+from datetime import UTC, datetime, timedelta
+from unittest.mock import patch
+
+import scripts.prefetch_tide_predictions as ptp
+
+STATIONS = [
+    {"id": "9414290", "name": "San Francisco", "lat": 37.806, "lon": -122.465},
+    {"id": "9414750", "name": "Alameda", "lat": 37.772, "lon": -122.300},
+    {"id": "9415020", "name": "Point Reyes", "lat": 37.996, "lon": -122.977},
+    {"id": "9411340", "name": "Santa Barbara", "lat": 34.408, "lon": -119.685},
+]
+
+
+def test_nearest_stations_ranked_by_distance():
+    selected = ptp.nearest_stations(STATIONS, 37.77, -122.30, count=2)
+    ids = [s["id"] for s in selected]
+    assert ids[0] == "9414750"  # Alameda is closest to Alameda
+    assert "9414290" in ids  # SF fallback always included
+
+
+def test_nearest_stations_appends_sf_fallback():
+    selected = ptp.nearest_stations(STATIONS, 34.4, -119.7, count=1)
+    ids = [s["id"] for s in selected]
+    assert ids == ["9411340", "9414290"]
+
+
+def test_bundle_is_fresh(tmp_path):
+    path = tmp_path / "tide_predictions.json"
+    assert not ptp.bundle_is_fresh(path)
+
+    path.write_text(json.dumps({"generated": datetime.now(UTC).isoformat()}))
+    assert ptp.bundle_is_fresh(path)
+
+    old = (datetime.now(UTC) - timedelta(hours=12)).isoformat()
+    path.write_text(json.dumps({"generated": old}))
+    assert not ptp.bundle_is_fresh(path)
+
+
+def test_bundle_is_fresh_corrupt_file(tmp_path):
+    path = tmp_path / "tide_predictions.json"
+    path.write_text("not json")
+    assert not ptp.bundle_is_fresh(path)
+
+
+def test_build_bundle_skips_failed_stations(tmp_path):
+    stations_path = tmp_path / "tide_stations.json"
+    stations_path.write_text(json.dumps({"stations": STATIONS}))
+
+    def fake_fetch(station_id, begin, end):
+        if station_id == "9414750":
+            raise RuntimeError("NOAA down")
+        return [{"t": "2026-04-22 12:00", "v": "3.1"}]
+
+    with patch.object(ptp, "fetch_station_predictions", side_effect=fake_fetch):
+        bundle = ptp.build_bundle(37.77, -122.30, stations_path=stations_path, count=2)
+
+    ids = [s["id"] for s in bundle["stations"]]
+    assert "9414750" not in ids
+    assert "9414290" in ids
+    assert bundle["days"] == ptp.BUNDLE_DAYS
+    assert bundle["stations"][0]["predictions"][0]["v"] == "3.1"
+
+
+def test_refresh_bundle_if_stale_skips_fresh(tmp_path):
+    (tmp_path / "data" / "telemetry").mkdir(parents=True)
+    bundle_path = tmp_path / ptp.TIDE_BUNDLE_FILE
+    bundle_path.write_text(json.dumps({"generated": datetime.now(UTC).isoformat()}))
+
+    with patch.object(ptp, "build_bundle") as mock_build:
+        assert ptp.refresh_bundle_if_stale(tmp_path, 37.8, -122.4) is None
+    mock_build.assert_not_called()
+
+
+def test_refresh_bundle_if_stale_writes_bundle(tmp_path):
+    (tmp_path / "data").mkdir()
+    (tmp_path / "data" / "tide_stations.json").write_text(json.dumps({"stations": STATIONS}))
+
+    with patch.object(ptp, "fetch_station_predictions",
+                      return_value=[{"t": "2026-04-22 12:00", "v": "3.1"}]):
+        result = ptp.refresh_bundle_if_stale(tmp_path, 37.8, -122.4)
+
+    assert result == tmp_path / ptp.TIDE_BUNDLE_FILE
+    bundle = json.loads(result.read_text())
+    assert bundle["stations"]
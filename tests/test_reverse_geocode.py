@@ -0,0 +1,88 @@
+"""Tests for the Pi-side Nominatim reverse-geocode cache."""
+from __future__ import annotations
+
+import json
+from unittest.mock import patch
+
+import scripts.reverse_geocode as rg
+
+
+class _FakeResp:
+    def __init__(self, payload):
+        self._payload = payload
+
+    def raise_for_status(self):
+        pass
+
+    def json(self):
+        return self._payload
+
+
+def _fake_requests(payload, calls):
+    class FakeRequests:
+        @staticmethod
+        def get(url, params=None, headers=None, timeout=10):
+            calls.append(params)
+            return _FakeResp(payload)
+
+    return FakeRequests
+
+
+def test_resolve_location_shortens_display_name(tmp_path):
+    calls = []
+    fake = _fake_requests({"display_name": "Sausalito, California, United States"}, calls)
+    with patch("scripts.reverse_geocode.requests", fake):
+        name = rg.resolve_location_name(37.859, -122.485, tmp_path / "cache.json")
+    assert name == "Sausalito, California"
+    assert len(calls) == 1
+
+
+def test_resolve_location_uses_cache_for_repeat_anchorage(tmp_path):
+    calls = []
+    fake = _fake_requests({"display_name": "Sausalito, California, USA"}, calls)
+    cache_path = tmp_path / "cache.json"
+    with patch("scripts.reverse_geocode.requests", fake):
+        rg.resolve_location_name(37.861, -122.486, cache_path)
+        # ~30 m away — same rounded cell, must not hit the API again.
+        name = rg.resolve_location_name(37.8612, -122.4863, cache_path)
+    assert name == "Sausalito, California"
+    assert len(calls) == 1
+    assert json.loads(cache_path.read_text())
+
+
+def test_resolve_location_returns_none_without_display_name(tmp_path):
+    fake = _fake_requests({"error": "Unable to geocode"}, [])
+    with patch("scripts.reverse_geocode.requests", fake):
+        assert rg.resolve_location_name(0.0, 0.0, tmp_path / "cache.json") is None
+
+
+def test_update_location_file_writes_blob(tmp_path):
+    fake = _fake_requests({"display_name": "Half Moon Bay, California, USA"}, [])
+    with patch("scripts.reverse_geocode.requests", fake):
+        path = rg.update_location_file(tmp_path, 37.47, -122.44)
+    assert path is not None
+    blob = json.loads(path.read_text())
+    assert blob["name"] == "Half Moon Bay, California"
+    assert blob["latitude"] == 37.47
+
+
+def test_update_location_file_skips_unchanged_cell(tmp_path):
+    calls = []
+    fake = _fake_requests({"display_name": "Half Moon Bay, California, USA"}, calls)
+    with patch("scripts.reverse_geocode.requests", fake):
+        rg.update_location_file(tmp_path, 37.47, -122.44)
+        result = rg.update_location_file(tmp_path, 37.4702, -122.4401)
+    assert result is None
+    assert len(calls) == 1
+
+
+def test_update_location_file_keeps_previous_on_failure(tmp_path):
+    ok = _fake_requests({"display_name": "Half Moon Bay, California, USA"}, [])
+    with patch("scripts.reverse_geocode.requests", ok):
+        rg.update_location_file(tmp_path, 37.47, -122.44)
+
+    failing = _fake_requests({"error": "Unable to geocode"}, [])
+    with patch("scripts.reverse_geocode.requests", failing):
+        assert rg.update_location_file(tmp_path, 40.0, -124.0) is None
+    blob = json.loads((tmp_path / rg.LOCATION_FILE).read_text())
+    assert blob["name"] == "Half Moon Bay, California"
@@ -0,0 +1,81 @@
+"""Tests for the SignalK WebSocket delta client state tree."""
+from __future__ import annotations
+
+from scripts.signalk_delta_client import SignalKDeltaClient, stream_url_from_api_url
+
+WHITELIST = frozenset({"navigation", "environment"})
+
+
+def _client() -> SignalKDeltaClient:
+    return SignalKDeltaClient("http://localhost:3000/signalk/v1/api/vessels/self", WHITELIST)
+
+
+def test_stream_url_from_api_url():
+    assert stream_url_from_api_url(
+        "http://boat.local:3000/signalk/v1/api/vessels/self"
+    ) == "ws://boat.local:3000/signalk/v1/stream?subscribe=none"
+
+
+def test_stream_url_uses_wss_for_https():
+    assert stream_url_from_api_url(
+        "https://boat.local:3443/signalk/v1/api/vessels/self"
+    ).startswith("wss://boat.local:3443/")
+
+
+def test_apply_delta_builds_rest_shaped_tree():
+    client = _client()
+    client.apply_delta({
+        "updates": [{
+            "timestamp": "2026-04-22T12:00:00Z",
+            "values": [
+                {"path": "navigation.position",
+                 "value": {"latitude": 37.8, "longitude": -122.4}},
+                {"path": "navigation.speedOverGround", "value": 3.2},
+            ],
+        }],
+    })
+    blob = client.snapshot()
+    assert blob["navigation"]["position"]["value"]["latitude"] == 37.8
+    assert blob["navigation"]["position"]["timestamp"] == "2026-04-22T12:00:00Z"
+    assert blob["navigation"]["speedOverGround"]["value"] == 3.2
+
+
+def test_apply_delta_ignores_paths_outside_whitelist():
+    client = _client()
+    client.apply_delta({
+        "updates": [{
+            "values": [
+                {"path": "design.length", "value": 12.2},
+                {"path": "environment.wind.speedTrue", "value": 5.1},
+            ],
+        }],
+    })
+    blob = client.snapshot()
+    assert "design" not in blob
+    assert blob["environment"]["wind"]["speedTrue"]["value"] == 5.1
+
+
+def test_later_delta_overwrites_leaf():
+    client = _client()
+    for speed in (2.0, 4.5):
+        client.apply_delta({
+            "updates": [{"values": [{"path": "navigation.speedOverGround", "value": speed}]}],
+        })
+    assert client.snapshot()["navigation"]["speedOverGround"]["value"] == 4.5
+
+
+def test_snapshot_is_a_copy():
+    client = _client()
+    client.apply_delta({
+        "updates": [{"values": [{"path": "navigation.speedOverGround", "value": 1.0}]}],
+    })
+    snap = client.snapshot()
+    snap["navigation"]["speedOverGround"]["value"] = 99.0
+    assert client.snapshot()["navigation"]["speedOverGround"]["value"] == 1.0
+
+
+def test_apply_delta_tolerates_malformed_messages():
+    client = _client()
+    client.apply_delta({"updates": "nope"})
+    client.apply_delta({"updates": [{"values": [{"value": 1.0}, "junk", {"path": ""}]}]})
+    assert not client.has_data()
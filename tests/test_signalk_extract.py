@@ -0,0 +1,78 @@
+"""Tests for the single-pass SignalK blob extraction engine."""
+from __future__ import annotations
+
+from scripts.signalk_extract import BlobExtractor, make_timestamp_parser
+
+WHITELIST = frozenset({"navigation", "environment"})
+
+
+def _blob():
+    return {
+        "navigation": {
+            "position": {
+                "value": {"latitude": 37.8, "longitude": -122.4},
+                "timestamp": "2026-05-01T12:00:00Z",
+            },
+            "speedOverGround": {"value": 3.2},
+            "headingTrue": {"value": 1.1},
+        },
+        "environment": {
+            "wind": {
+                "speedTrue": {"value": 6.5},
+                "angleTrue": {"value": 0.4},
+            },
+            # Mixed object value — only numeric leaves should flatten.
+            "current": {"value": {"drift": 0.3, "setTrue": None}},
+        },
+        # Not snapshot-whitelisted, but numeric readings still collect.
+        "propulsion": {
+            "port": {"revolutions": {"value": 20.0}},
+            "starboard": {"revolutions": {"value": 25.0}},
+        },
+    }
+
+
+def test_extract_point_fields_in_one_pass():
+    result = BlobExtractor(WHITELIST).extract(_blob())
+    assert result.latitude == 37.8
+    assert result.longitude == -122.4
+    assert result.position_timestamp == "2026-05-01T12:00:00Z"
+    assert result.speed_over_ground == 3.2
+    assert result.heading_true == 1.1
+    assert result.wind_speed == 6.5
+    assert result.wind_angle == 0.4
+    assert result.engine_rpm == 25.0  # max across engines
+
+
+def test_extract_snapshot_values_match_collector_rules():
+    values = {v["path"]: v["value"] for v in BlobExtractor(WHITELIST).extract(_blob()).snapshot_values}
+    # All-numeric object values stay compact.
+    assert values["navigation.position"] == {"latitude": 37.8, "longitude": -122.4}
+    assert values["navigation.speedOverGround"] == 3.2
+    # Mixed object values flatten to their numeric leaves only.
+    assert values["environment.current.drift"] == 0.3
+    assert "environment.current" not in values
+    # Non-whitelisted branches stay out of the snapshot.
+    assert not any(path.startswith("propulsion") for path in values)
+
+
+def test_extract_numeric_values_cover_all_branches():
+    numeric = BlobExtractor(WHITELIST).extract(_blob()).numeric_values
+    assert numeric["propulsion.port.revolutions"] == 20.0
+    assert numeric["environment.wind.speedTrue"] == 6.5
+    assert numeric["navigation.position.latitude"] == 37.8
+
+
+def test_extract_handles_non_dict_blob():
+    result = BlobExtractor(WHITELIST).extract(None)
+    assert result.snapshot_values == []
+    assert result.numeric_values == {}
+    assert result.latitude is None
+
+
+def test_timestamp_parser_memoizes():
+    parse = make_timestamp_parser()
+    first = parse("2026-05-01T12:00:00Z")
+    assert first is parse("2026-05-01T12:00:00Z")  # cached object, not re-parsed
+    assert parse("not a timestamp") is None
+    assert parse(None) is None
@@ -0,0 +1,65 @@
+import json
+import math
+from datetime import UTC, datetime
+
+import scripts.telemetry_archive as ta
+
+
+def _ts(hour=12, minute=0):
+    return datetime(2026, 4, 22, hour, minute, 0, tzinfo=UTC)
+
+
+def test_pack_record_size():
+    record = ta.pack_record(_ts(), 37.8, -122.4, sog=2.5)
+    assert len(record) == ta.RECORD_SIZE
+
+
+def test_round_trip_full_record(tmp_path):
+    ta.append_record(
+        tmp_path, _ts(), 37.8, -122.4,
+        sog=2.5, cog=1.1, wind_speed=6.0, wind_angle=0.7,
+    )
+    points = ta.read_day(tmp_path, "2026-04-22")
+    assert len(points) == 1
+    p = points[0]
+    assert p["timestamp"] == _ts()
+    assert p["latitude"] == 37.8
+    assert p["longitude"] == -122.4
+    assert math.isclose(p["sog"], 2.5, rel_tol=1e-6)
+    assert math.isclose(p["wind_angle"], 0.7, rel_tol=1e-6)
+
+
+def test_missing_values_become_none(tmp_path):
+    ta.append_record(tmp_path, _ts(), 37.8, -122.4)
+    p = ta.read_day(tmp_path, "2026-04-22")[0]
+    assert p["sog"] is None
+    assert p["cog"] is None
+    assert p["wind_speed"] is None
+    assert p["wind_angle"] is None
+
+
+def test_append_is_ordered(tmp_path):
+    for minute in (0, 5, 10):
+        ta.append_record(tmp_path, _ts(minute=minute), 37.8, -122.4)
+    points = ta.read_day(tmp_path, "2026-04-22")
+    stamps = [p["timestamp"] for p in points]
+    assert stamps == sorted(stamps)
+    assert len(points) == 3
+
+
+def test_index_tracks_days_and_record_counts(tmp_path):
+    ta.append_record(tmp_path, _ts(), 37.8, -122.4)
+    ta.append_record(tmp_path, _ts(hour=13), 37.9, -122.5)
+    ta.append_record(tmp_path, datetime(2026, 4, 23, 9, 0, tzinfo=UTC), 38.0, -122.6)
+
+    index_path = tmp_path / ta.ARCHIVE_DIR_NAME / ta.ARCHIVE_INDEX_NAME
+    index = json.loads(index_path.read_text())
+    assert index["record_size"] == ta.RECORD_SIZE
+    days = {d["date"]: d for d in index["days"]}
+    assert days["2026-04-22"]["records"] == 2
+    assert days["2026-04-23"]["records"] == 1
+    assert days["2026-04-23"]["file"] == "2026-04-23.bin"
+
+
+def test_read_day_missing_file(tmp_path):
+    assert ta.read_day(tmp_path, "2026-01-01") == []
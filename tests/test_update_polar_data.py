@@ -297,3 +297,81 @@ def test_fetch_polar_sample_returns_none_on_network_error():
 
     with patch("scripts.update_polar_data.requests", BrokenRequests):
         assert upd.fetch_polar_sample("http://fake") is None
+
+
+# --- main() flush behavior ---
+
+def _main_args(tmp_path, flush_interval):
+    from types import SimpleNamespace
+    return SimpleNamespace(
+        signalk_url="http://fake",
+        interval=0,
+        flush_interval=flush_interval,
+        accumulator=str(tmp_path / "acc.json"),
+        output=str(tmp_path / "polars.csv"),
+    )
+
+def test_main_one_shot_writes_immediately_without_flush_interval(tmp_path):
+    with (
+        patch("scripts.update_polar_data.parse_args", return_value=_main_args(tmp_path, 0)),
+        patch("scripts.update_polar_data.fetch_polar_sample", return_value=(90.0, 12.0, 6.0)),
+    ):
+        assert upd.main() == 0
+    assert (tmp_path / "acc.json").exists()
+    assert (tmp_path / "polars.csv").exists()
+
+def test_main_flushes_pending_improvements_on_exit(tmp_path):
+    # flush_interval far in the future: the improvement stays in memory during
+    # the loop and must be written by the shutdown flush.
+    with (
+        patch("scripts.update_polar_data.parse_args", return_value=_main_args(tmp_path, 3600)),
+        patch("scripts.update_polar_data.fetch_polar_sample", return_value=(90.0, 12.0, 6.0)),
+    ):
+        assert upd.main() == 0
+    acc = upd.load_accumulator(tmp_path / "acc.json")
+    assert acc["observations"] == 1
+    assert acc["bins"]
+    assert (tmp_path / "polars.csv").exists()
+
+
+# --- dense interpolation grid ---
+
+def _grid_acc():
+    acc = {"bins": {}, "observations": 0, "last_updated": None}
+    # Populate two well-separated cells so interpolation has a gradient.
+    upd.update_accumulator(acc, 90.0, 10.0, 6.0)
+    upd.update_accumulator(acc, 135.0, 20.0, 8.0)
+    return acc
+
+def test_build_dense_grid_dimensions():
+    grid = upd.build_dense_grid(_grid_acc())
+    assert grid["twa_step"] == upd.GRID_TWA_STEP
+    assert len(grid["values"]) == 180 // upd.GRID_TWA_STEP + 1
+    cols = (upd.GRID_TWS_MAX - upd.GRID_TWS_MIN) // upd.GRID_TWS_STEP + 1
+    assert all(len(row) == cols for row in grid["values"])
+
+def test_build_dense_grid_matches_coarse_table_at_nodes():
+    acc = _grid_acc()
+    grid = upd.build_dense_grid(acc)
+    row = 90 // upd.GRID_TWA_STEP
+    col = (10 - upd.GRID_TWS_MIN) // upd.GRID_TWS_STEP
+    assert grid["values"][row][col] == round(upd._best_speed(acc, 90.0, 10.0), 2)
+
+def test_build_dense_grid_interpolates_between_nodes():
+    acc = _grid_acc()
+    grid = upd.build_dense_grid(acc)
+    row = 90 // upd.GRID_TWA_STEP
+    # polars have TWS columns at 10 and 12 — 11kts must land between them.
+    cols = {tws: (tws - upd.GRID_TWS_MIN) // upd.GRID_TWS_STEP for tws in (10, 11, 12)}
+    lo = grid["values"][row][cols[10]]
+    mid = grid["values"][row][cols[11]]
+    hi = grid["values"][row][cols[12]]
+    assert min(lo, hi) <= mid <= max(lo, hi)
+
+def test_write_polar_grid(tmp_path):
+    path = tmp_path / "polars_grid.json"
+    upd.write_polar_grid(_grid_acc(), path)
+    import json as _json
+    grid = _json.loads(path.read_text())
+    assert grid["tws_min"] == upd.GRID_TWS_MIN
+    assert grid["values"]
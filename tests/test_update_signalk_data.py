@@ -7,6 +7,7 @@ from pathlib import Path
 from unittest.mock import patch
 
 import scripts.update_signalk_data as usd
+from scripts import telemetry_archive
 
 
 def test_filter_stale_data_removes_old_values():
@@ -512,3 +513,319 @@ def test_integration_updates_test_branch(tmp_path, test_branch):
         assert (
             before_after
         ), f"{test_branch} branch should exist on origin and have a commit"
+
+
+# ---------------------------------------------------------------------------
+# Batched push triggers
+# ---------------------------------------------------------------------------
+
+def test_should_flush_batch_when_full():
+    assert usd._should_flush_batch(
+        5, 1.0, None, batch_size=5, batch_minutes=0, push_distance_m=500
+    )
+
+
+def test_should_not_flush_partial_batch():
+    assert not usd._should_flush_batch(
+        2, 1.0, 50.0, batch_size=5, batch_minutes=0, push_distance_m=500
+    )
+
+
+def test_should_flush_on_batch_timer():
+    assert usd._should_flush_batch(
+        1, 15.1, None, batch_size=10, batch_minutes=15, push_distance_m=500
+    )
+
+
+def test_should_flush_on_distance_moved():
+    assert usd._should_flush_batch(
+        1, 0.5, 600.0, batch_size=10, batch_minutes=15, push_distance_m=500
+    )
+
+
+def test_distance_trigger_disabled_when_zero():
+    assert not usd._should_flush_batch(
+        1, 0.5, 10_000.0, batch_size=10, batch_minutes=0, push_distance_m=0
+    )
+
+
+def test_read_blob_position(tmp_path):
+    blob = {"navigation": {"position": {"value": {"latitude": 37.8, "longitude": -122.4}}}}
+    path = tmp_path / "signalk_latest.json"
+    path.write_text(json.dumps(blob))
+    assert usd._read_blob_position(path) == (37.8, -122.4)
+
+
+def test_read_blob_position_missing_or_corrupt(tmp_path):
+    path = tmp_path / "signalk_latest.json"
+    assert usd._read_blob_position(path) is None
+    path.write_text("not json")
+    assert usd._read_blob_position(path) is None
+
+
+# ---------------------------------------------------------------------------
+# Sharded instrument log
+# ---------------------------------------------------------------------------
+
+def test_instrument_shard_appends_and_updates_manifest(tmp_path):
+    ts = datetime(2026, 4, 22, 12, 0, tzinfo=UTC)
+    usd._append_instrument_shard(tmp_path, ts, {"navigation.speedOverGround": 2.5})
+    usd._append_instrument_shard(tmp_path, ts + timedelta(minutes=5), {"navigation.speedOverGround": 3.0})
+
+    shard = json.loads((tmp_path / "instrument_log" / "2026-04-22.json").read_text())
+    assert len(shard["entries"]) == 2
+    assert shard["entries"][1]["values"]["navigation.speedOverGround"] == 3.0
+
+    manifest = json.loads((tmp_path / "instrument_log" / "manifest.json").read_text())
+    assert manifest["shards"] == [
+        {"date": "2026-04-22", "file": "2026-04-22.json", "entries": 2}
+    ]
+
+
+def test_instrument_shard_caps_entries(tmp_path):
+    ts = datetime(2026, 4, 22, 0, 0, tzinfo=UTC)
+    with patch.object(usd, "INSTRUMENT_LOG_SHARD_ENTRIES", 3):
+        for i in range(5):
+            usd._append_instrument_shard(tmp_path, ts + timedelta(minutes=i), {"v": float(i)})
+    shard = json.loads((tmp_path / "instrument_log" / "2026-04-22.json").read_text())
+    assert len(shard["entries"]) == 3
+    assert shard["entries"][-1]["values"]["v"] == 4.0
+
+
+def test_instrument_shard_prunes_old_days(tmp_path):
+    old_ts = datetime(2026, 4, 1, 12, 0, tzinfo=UTC)
+    usd._append_instrument_shard(tmp_path, old_ts, {"v": 1.0})
+    new_ts = datetime(2026, 4, 22, 12, 0, tzinfo=UTC)
+    usd._append_instrument_shard(tmp_path, new_ts, {"v": 2.0})
+
+    shard_dir = tmp_path / "instrument_log"
+    assert not (shard_dir / "2026-04-01.json").exists()
+    manifest = json.loads((shard_dir / "manifest.json").read_text())
+    assert [s["date"] for s in manifest["shards"]] == ["2026-04-22"]
+
+
+def test_instrument_shard_recovers_from_corrupt_manifest(tmp_path):
+    shard_dir = tmp_path / "instrument_log"
+    shard_dir.mkdir()
+    (shard_dir / "manifest.json").write_text("not json")
+    ts = datetime(2026, 4, 22, 12, 0, tzinfo=UTC)
+    usd._append_instrument_shard(tmp_path, ts, {"v": 1.0})
+    manifest = json.loads((shard_dir / "manifest.json").read_text())
+    assert manifest["shards"][0]["date"] == "2026-04-22"
+
+
+# ---------------------------------------------------------------------------
+# Positions-index archive pages
+# ---------------------------------------------------------------------------
+
+def _index_entry(ts: str) -> dict:
+    return {"timestamp": ts, "file": "f.json",
+            "values": [{"path": "navigation.position",
+                        "value": {"latitude": 37.8, "longitude": -122.4}}]}
+
+
+def test_archive_position_entries_writes_monthly_pages(tmp_path):
+    usd._archive_position_entries(tmp_path, [
+        _index_entry("2026-03-31T23:00:00+00:00"),
+        _index_entry("2026-04-01T01:00:00+00:00"),
+    ])
+
+    pages_dir = tmp_path / "positions_index_pages"
+    march = json.loads((pages_dir / "2026-03.json").read_text())
+    april = json.loads((pages_dir / "2026-04.json").read_text())
+    assert len(march["positions"]) == 1
+    assert len(april["positions"]) == 1
+
+    manifest = json.loads((pages_dir / "manifest.json").read_text())
+    assert [p["month"] for p in manifest["pages"]] == ["2026-03", "2026-04"]
+    assert manifest["pages"][0]["entries"] == 1
+
+
+def test_archive_position_entries_deduplicates(tmp_path):
+    entry = _index_entry("2026-04-01T01:00:00+00:00")
+    usd._archive_position_entries(tmp_path, [entry])
+    usd._archive_position_entries(tmp_path, [entry, _index_entry("2026-04-01T02:00:00+00:00")])
+
+    page = json.loads((tmp_path / "positions_index_pages" / "2026-04.json").read_text())
+    assert len(page["positions"]) == 2
+
+
+def test_archive_position_entries_noop_when_empty(tmp_path):
+    usd._archive_position_entries(tmp_path, [])
+    assert not (tmp_path / "positions_index_pages").exists()
+
+
+def test_prune_blob_keeps_only_manifest_branches():
+    blob = {
+        "name": "Mermug",
+        "navigation": {"position": {"value": {"latitude": 1.0, "longitude": 2.0}}},
+        "design": {"length": {"value": {"overall": 12}}},
+        "sensors": {"gps": {"fromBow": {"value": 1}}},
+        "notifications": {"mob": {}},
+    }
+    pruned = usd.prune_blob_to_manifest(blob)
+    assert set(pruned) == {"name", "navigation", "design"}
+    assert pruned["navigation"] == blob["navigation"]
+
+
+def test_prune_blob_passes_through_non_signalk_payloads():
+    blob = {"ok": True}
+    assert usd.prune_blob_to_manifest(blob) == {"ok": True}
+
+
+def test_load_path_manifest_missing_file_uses_fallback(tmp_path):
+    manifest = usd._load_path_manifest(tmp_path / "missing.json")
+    assert manifest == usd._FALLBACK_PATH_MANIFEST
+
+
+def test_load_path_manifest_merges_overrides(tmp_path):
+    path = tmp_path / "signalk_paths.json"
+    path.write_text(json.dumps({"snapshot_branches": ["navigation"], "root_attributes": []}))
+    manifest = usd._load_path_manifest(path)
+    assert manifest["snapshot_branches"] == ["navigation"]
+    # Empty or missing keys fall back to the built-in values.
+    assert manifest["root_attributes"] == ["name", "mmsi"]
+    assert manifest["point_paths"]["position"] == "navigation.position"
+
+
+def _fold_voyage(tmp_path, ts, lat, lon, speed_ms=3.0, rpm=None):
+    usd._update_voyage_stats(tmp_path, ts, lat, lon, speed_ms, rpm)
+    return json.loads((tmp_path / "voyage_stats.json").read_text())
+
+
+def test_voyage_stats_accumulates_distance_and_time(tmp_path):
+    t0 = datetime(2026, 5, 1, 12, 0, tzinfo=UTC)
+    _fold_voyage(tmp_path, t0, 37.80, -122.40)
+    # ~0.6 nm north, ten minutes later, well underway.
+    stats = _fold_voyage(tmp_path, t0 + timedelta(minutes=10), 37.81, -122.40)
+    day = stats["days"]["2026-05-01"]
+    assert 0.5 < day["distance_nm"] < 0.7
+    assert abs(day["underway_hours"] - 10 / 60) < 0.01
+    assert stats["totals"]["sailing_days"] == 1
+    assert stats["totals"]["avg_speed_kts"] > 0
+
+
+def test_voyage_stats_ignores_long_gaps(tmp_path):
+    t0 = datetime(2026, 5, 1, 12, 0, tzinfo=UTC)
+    _fold_voyage(tmp_path, t0, 37.80, -122.40)
+    # Two hours of outage: no distance or underway time credited.
+    stats = _fold_voyage(tmp_path, t0 + timedelta(hours=2), 37.90, -122.40)
+    day = stats["days"]["2026-05-01"]
+    assert day["distance_nm"] == 0.0
+    assert day["underway_hours"] == 0.0
+
+
+def test_voyage_stats_moored_adds_no_underway_time(tmp_path):
+    t0 = datetime(2026, 5, 1, 12, 0, tzinfo=UTC)
+    _fold_voyage(tmp_path, t0, 37.80, -122.40, speed_ms=0.1)
+    stats = _fold_voyage(tmp_path, t0 + timedelta(minutes=5), 37.80, -122.40, speed_ms=0.1)
+    assert stats["days"]["2026-05-01"]["underway_hours"] == 0.0
+    assert stats["totals"]["sailing_days"] == 0
+
+
+def test_voyage_stats_counts_engine_hours(tmp_path):
+    t0 = datetime(2026, 5, 1, 12, 0, tzinfo=UTC)
+    _fold_voyage(tmp_path, t0, 37.80, -122.40, rpm=20.0)
+    stats = _fold_voyage(tmp_path, t0 + timedelta(minutes=30), 37.82, -122.40, rpm=20.0)
+    assert abs(stats["totals"]["engine_hours"] - 0.5) < 0.01
+
+
+def test_voyage_stats_recovers_from_corrupt_file(tmp_path):
+    (tmp_path / "voyage_stats.json").write_text("{not json")
+    stats = _fold_voyage(tmp_path, datetime(2026, 5, 1, 12, 0, tzinfo=UTC), 37.80, -122.40)
+    assert stats["days"]["2026-05-01"]["samples"] == 1
+
+
+def test_update_position_cache_writes_voyage_stats(tmp_path):
+    blob = {
+        "navigation": {
+            "position": {
+                "value": {"latitude": 37.80, "longitude": -122.40},
+                "timestamp": "2026-05-01T12:00:00Z",
+            },
+            "speedOverGround": {"value": 3.0},
+        },
+        "propulsion": {"port": {"revolutions": {"value": 25.0}}},
+    }
+    usd.update_position_cache(blob, tmp_path / "out.json")
+    stats = json.loads((tmp_path / "voyage_stats.json").read_text())
+    assert stats["days"]["2026-05-01"]["samples"] == 1
+    assert stats["days"]["2026-05-01"]["max_speed_kts"] > 5
+
+
+def test_record_update_metrics_appends_and_caps(tmp_path):
+    for i in range(usd.UPDATE_METRICS_MAX_CYCLES + 10):
+        usd._record_update_metrics(tmp_path, {"fetch": 0.1, "total": 0.2 + i * 0.001})
+    metrics = json.loads((tmp_path / "update_metrics.json").read_text())
+    assert len(metrics["cycles"]) == usd.UPDATE_METRICS_MAX_CYCLES
+    last = metrics["cycles"][-1]
+    assert last["fetch_ms"] == 100.0
+    assert "timestamp" in last
+
+
+def test_record_update_metrics_recovers_from_corrupt_file(tmp_path):
+    (tmp_path / "update_metrics.json").write_text("{not json")
+    usd._record_update_metrics(tmp_path, {"git": 1.5})
+    metrics = json.loads((tmp_path / "update_metrics.json").read_text())
+    assert len(metrics["cycles"]) == 1
+    assert metrics["cycles"][0]["git_ms"] == 1500.0
+
+
+def _write_snapshot(output_dir, ts, lat=37.80, lon=-122.40, sog=3.0):
+    name = usd._format_position_filename(ts)
+    (output_dir / name).write_text(json.dumps({
+        "context": "vessels.self",
+        "updates": [{
+            "timestamp": ts.isoformat(),
+            "values": [
+                {"path": "navigation.position",
+                 "value": {"latitude": lat, "longitude": lon}},
+                {"path": "navigation.speedOverGround", "value": sog},
+            ],
+        }],
+    }))
+    return name
+
+
+def test_prune_retires_expired_manifest_entries(tmp_path):
+    now = datetime.now(UTC)
+    old = _write_snapshot(tmp_path, now - timedelta(hours=30))
+    older = _write_snapshot(tmp_path, now - timedelta(hours=26))
+    fresh = _write_snapshot(tmp_path, now - timedelta(hours=1))
+    usd._write_retention_manifest(tmp_path, sorted([old, older, fresh]))
+    usd._prune_old_position_files(tmp_path)
+    assert not (tmp_path / old).exists()
+    assert not (tmp_path / older).exists()
+    assert (tmp_path / fresh).exists()
+    manifest = json.loads((tmp_path / "retention_manifest.json").read_text())
+    assert manifest["files"] == [fresh]
+
+
+def test_prune_rebuilds_manifest_from_directory_scan(tmp_path):
+    now = datetime.now(UTC)
+    old = _write_snapshot(tmp_path, now - timedelta(hours=30))
+    fresh = _write_snapshot(tmp_path, now - timedelta(hours=1))
+    usd._prune_old_position_files(tmp_path)
+    assert not (tmp_path / old).exists()
+    manifest = json.loads((tmp_path / "retention_manifest.json").read_text())
+    assert manifest["files"] == [fresh]
+
+
+def test_retired_snapshot_folds_into_daily_archive(tmp_path):
+    ts = datetime.now(UTC) - timedelta(hours=30)
+    name = _write_snapshot(tmp_path, ts, lat=37.81, lon=-122.41, sog=2.5)
+    usd._write_retention_manifest(tmp_path, [name])
+    usd._prune_old_position_files(tmp_path)
+    points = telemetry_archive.read_day(tmp_path, ts.strftime("%Y-%m-%d"))
+    assert len(points) == 1
+    assert abs(points[0]["latitude"] - 37.81) < 1e-9
+    assert abs(points[0]["sog"] - 2.5) < 1e-6
+
+
+def test_fold_skips_snapshots_already_archived(tmp_path):
+    ts = datetime.now(UTC) - timedelta(hours=30)
+    name = _write_snapshot(tmp_path, ts)
+    telemetry_archive.append_record(tmp_path, ts, 37.80, -122.40, sog=3.0)
+    usd._write_retention_manifest(tmp_path, [name])
+    usd._prune_old_position_files(tmp_path)
+    assert len(telemetry_archive.read_day(tmp_path, ts.strftime("%Y-%m-%d"))) == 1